@@ -121,6 +121,14 @@ func runAPI() {
 	command := flag.Arg(0)
 	args := flag.Args()[1:]
 
+	// Hot read-only queries go to the resident daemon when possible, so
+	// install scripts calling `api` in a loop skip the cold start; anything
+	// the daemon cannot answer runs locally below
+	if output, exitCode, ok := queryAPIDaemon(strings.ToLower(command), args); ok {
+		fmt.Print(output)
+		os.Exit(exitCode)
+	}
+
 	// Execute the requested command
 	switch strings.ToLower(command) {
 	case "package_info":
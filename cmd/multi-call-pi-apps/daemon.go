@@ -0,0 +1,369 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: daemon.go
+// Description: Resident daemon mode for the api subcommand. Install
+// scripts call `api <fn>` dozens of times and every invocation cold-starts
+// i18n, the app index and the package state; the daemon keeps those warm
+// in one process (their caches already invalidate on mtime/fingerprint
+// changes) and answers hot read-only queries over a unix socket, so
+// repeat calls become single-digit-millisecond RPCs. The first query
+// starts the daemon; anything it cannot answer falls back to running
+// locally. Set PI_APPS_API_DAEMON=0 to disable.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package main
+
+import (
+	"encoding/json"
+	"fmt"
+	"net"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strings"
+	"sync/atomic"
+	"syscall"
+	"time"
+
+	"github.com/pi-apps-go/pi-apps/pkg/api"
+)
+
+// apiDaemonIdleTimeout is how long the daemon lingers without requests
+// before exiting
+const apiDaemonIdleTimeout = 15 * time.Minute
+
+// apiDaemonRequest is one RPC from an api invocation
+type apiDaemonRequest struct {
+	Command string   `json:"command"`
+	Args    []string `json:"args"`
+}
+
+// apiDaemonResponse carries the command output back to the caller. Handled
+// is false when the daemon cannot answer (unknown command, bad arguments
+// or an error) and the caller should run the command locally.
+type apiDaemonResponse struct {
+	Handled bool   `json:"handled"`
+	Output  string `json:"output"`
+	Exit    int    `json:"exit"`
+}
+
+// apiDaemonCommands is the set of read-only queries served from the warm
+// caches; everything else keeps running in-process
+var apiDaemonCommands = map[string]bool{
+	"list_apps":                 true,
+	"read_category_files":       true,
+	"app_prefix_category":       true,
+	"app_status":                true,
+	"app_type":                  true,
+	"script_name":               true,
+	"script_name_cpu":           true,
+	"pkgapp_packages_required":  true,
+	"will_reinstall":            true,
+	"package_installed":         true,
+	"package_available":         true,
+	"package_installed_version": true,
+	"package_latest_version":    true,
+	"package_is_new_enough":     true,
+}
+
+// apiDaemonSocketPath returns the per-install socket location
+func apiDaemonSocketPath() string {
+	return filepath.Join(api.GetPiAppsDir(), "data", "api-daemon.sock")
+}
+
+// queryAPIDaemon tries to answer the command via the resident daemon,
+// starting it on first use. Returns ok=false when the command is not
+// daemon-eligible or the daemon could not be reached, in which case the
+// caller runs the command locally.
+func queryAPIDaemon(command string, args []string) (output string, exitCode int, ok bool) {
+	if !apiDaemonCommands[command] || os.Getenv("PI_APPS_API_DAEMON") == "0" {
+		return "", 0, false
+	}
+
+	conn := connectAPIDaemon()
+	if conn == nil {
+		return "", 0, false
+	}
+	defer conn.Close()
+
+	conn.SetDeadline(time.Now().Add(10 * time.Second))
+	if err := json.NewEncoder(conn).Encode(apiDaemonRequest{Command: command, Args: args}); err != nil {
+		return "", 0, false
+	}
+
+	var resp apiDaemonResponse
+	if err := json.NewDecoder(conn).Decode(&resp); err != nil || !resp.Handled {
+		return "", 0, false
+	}
+	return resp.Output, resp.Exit, true
+}
+
+// connectAPIDaemon connects to the daemon socket, spawning the daemon if
+// nothing is listening yet
+func connectAPIDaemon() net.Conn {
+	socketPath := apiDaemonSocketPath()
+
+	if conn, err := net.DialTimeout("unix", socketPath, time.Second); err == nil {
+		return conn
+	}
+
+	// Nothing listening; start the daemon detached and give it a moment
+	executable, err := os.Executable()
+	if err != nil {
+		return nil
+	}
+	cmd := exec.Command(executable, "api-daemon")
+	cmd.Stdout = nil
+	cmd.Stderr = nil
+	cmd.SysProcAttr = &syscall.SysProcAttr{Setsid: true}
+	if err := cmd.Start(); err != nil {
+		return nil
+	}
+	go cmd.Wait()
+
+	for i := 0; i < 25; i++ {
+		time.Sleep(20 * time.Millisecond)
+		if conn, err := net.DialTimeout("unix", socketPath, time.Second); err == nil {
+			return conn
+		}
+	}
+	return nil
+}
+
+// runAPIDaemon is the daemon entrypoint (the `api-daemon` mode)
+func runAPIDaemon() {
+	socketPath := apiDaemonSocketPath()
+
+	// If another daemon is already serving, leave it alone
+	if conn, err := net.DialTimeout("unix", socketPath, time.Second); err == nil {
+		conn.Close()
+		return
+	}
+	os.Remove(socketPath)
+
+	listener, err := net.Listen("unix", socketPath)
+	if err != nil {
+		api.ErrorNoExitT(api.Tf("api-daemon: failed to listen on %s: %v", socketPath, err))
+		os.Exit(1)
+	}
+	defer listener.Close()
+	defer os.Remove(socketPath)
+
+	// Exit after sitting idle so the daemon never outlives a session for long
+	var lastRequest atomic.Int64
+	lastRequest.Store(time.Now().UnixNano())
+	go func() {
+		for {
+			time.Sleep(time.Minute)
+			if time.Since(time.Unix(0, lastRequest.Load())) > apiDaemonIdleTimeout {
+				listener.Close()
+				os.Remove(socketPath)
+				os.Exit(0)
+			}
+		}
+	}()
+
+	for {
+		conn, err := listener.Accept()
+		if err != nil {
+			return
+		}
+		lastRequest.Store(time.Now().UnixNano())
+		go serveAPIDaemonConn(conn)
+	}
+}
+
+// serveAPIDaemonConn answers a single request and closes the connection
+func serveAPIDaemonConn(conn net.Conn) {
+	defer conn.Close()
+	conn.SetDeadline(time.Now().Add(30 * time.Second))
+
+	var req apiDaemonRequest
+	if err := json.NewDecoder(conn).Decode(&req); err != nil {
+		return
+	}
+
+	output, exitCode, handled := executeAPIDaemonCommand(req.Command, req.Args)
+	json.NewEncoder(conn).Encode(apiDaemonResponse{Handled: handled, Output: output, Exit: exitCode})
+}
+
+// executeAPIDaemonCommand runs one query against the warm caches. Output
+// matches what the CLI handlers print on success; any error reports the
+// command as unhandled so the caller's local run can format it.
+func executeAPIDaemonCommand(command string, args []string) (string, int, bool) {
+	var out strings.Builder
+
+	switch command {
+	case "list_apps":
+		var filter string
+		if len(args) > 0 {
+			filter = args[0]
+		}
+		apps, err := api.ListApps(filter)
+		if err != nil {
+			return "", 0, false
+		}
+		for _, app := range apps {
+			fmt.Fprintln(&out, app)
+		}
+
+	case "read_category_files":
+		entries, err := api.ReadCategoryFiles(api.GetPiAppsDir())
+		if err != nil {
+			return "", 0, false
+		}
+		for _, entry := range entries {
+			fmt.Fprintln(&out, entry)
+		}
+
+	case "app_prefix_category":
+		var category string
+		if len(args) > 0 {
+			category = args[0]
+		}
+		result, err := api.AppPrefixCategory(api.GetPiAppsDir(), category)
+		if err != nil {
+			return "", 0, false
+		}
+		for _, item := range result {
+			fmt.Fprintln(&out, item)
+		}
+
+	case "app_status":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		status, err := api.GetAppStatus(args[0])
+		if err != nil {
+			return "", 0, false
+		}
+		fmt.Fprintln(&out, status)
+
+	case "app_type":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		appType, err := api.AppType(args[0])
+		if err != nil {
+			return "", 0, false
+		}
+		fmt.Fprintln(&out, appType)
+
+	case "script_name":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		scriptName, err := api.ScriptName(args[0])
+		if err != nil {
+			return "", 0, false
+		}
+		fmt.Fprintln(&out, scriptName)
+
+	case "script_name_cpu":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		scriptName, err := api.ScriptNameCPU(args[0])
+		if err != nil {
+			return "", 0, false
+		}
+		fmt.Fprintln(&out, scriptName)
+
+	case "pkgapp_packages_required":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		packages, err := api.PkgAppPackagesRequired(args[0])
+		if err != nil {
+			return "", 0, false
+		}
+		fmt.Fprintln(&out, packages)
+
+	case "will_reinstall":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		willReinstall, err := api.WillReinstall(args[0])
+		if err != nil {
+			return "", 0, false
+		}
+		if willReinstall {
+			return "true\n", 0, true
+		}
+		return "false\n", 1, true
+
+	case "package_installed":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		if api.PackageInstalled(args[0]) {
+			return "true\n", 0, true
+		}
+		return "false\n", 1, true
+
+	case "package_available":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		var arch string
+		if len(args) > 1 {
+			arch = args[1]
+		}
+		if api.PackageAvailable(args[0], arch) {
+			return "true\n", 0, true
+		}
+		return "false\n", 1, true
+
+	case "package_installed_version":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		version, err := api.PackageInstalledVersion(args[0])
+		if err != nil {
+			return "", 0, false
+		}
+		fmt.Fprintln(&out, version)
+
+	case "package_latest_version":
+		if len(args) < 1 {
+			return "", 0, false
+		}
+		var repoArgs []string
+		if len(args) >= 3 && args[1] == "-t" {
+			repoArgs = []string{"-t", args[2]}
+		}
+		version, err := api.PackageLatestVersion(args[0], repoArgs...)
+		if err != nil {
+			return "", 0, false
+		}
+		fmt.Fprintln(&out, version)
+
+	case "package_is_new_enough":
+		if len(args) < 2 {
+			return "", 0, false
+		}
+		if api.PackageIsNewEnough(args[0], args[1]) {
+			return "true\n", 0, true
+		}
+		return "false\n", 1, true
+
+	default:
+		return "", 0, false
+	}
+
+	return out.String(), 0, true
+}
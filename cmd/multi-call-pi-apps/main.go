@@ -93,6 +93,8 @@ func main() {
 			case "api":
 				os.Args = append([]string{"api"}, originalArgs[2:]...)
 				runAPI()
+			case "api-daemon":
+				runAPIDaemon()
 			case "gui":
 				os.Args = append([]string{"gui"}, originalArgs[2:]...)
 				runGUI()
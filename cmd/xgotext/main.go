@@ -23,6 +23,8 @@
 package main
 
 import (
+	"crypto/sha256"
+	"encoding/json"
 	"flag"
 	"fmt"
 	"go/ast"
@@ -31,10 +33,14 @@ import (
 	"os"
 	"os/exec"
 	"path/filepath"
+	"runtime"
 	"sort"
 	"strconv"
 	"strings"
+	"sync"
 	"time"
+
+	"github.com/pi-apps-go/pi-apps/pkg/api"
 )
 
 // TranslationEntry represents a translatable string with its source location
@@ -533,11 +539,20 @@ func extractTranslationFromCall(call *ast.CallExpr, fset *token.FileSet, sourceF
 	return "", "", "", false
 }
 
-func processFile(filePath string, ts *TranslationSet) error {
+// extractedEntry is one translation call found in a file; the per-file
+// entry lists are what the workers produce and the cache stores
+type extractedEntry struct {
+	MsgID       string `json:"msgid"`
+	MsgIDPlural string `json:"msgid_plural,omitempty"`
+	Line        int    `json:"line"`
+	Function    string `json:"function"`
+}
+
+func processFile(filePath string, src []byte) ([]extractedEntry, error) {
 	fset := token.NewFileSet()
-	node, err := parser.ParseFile(fset, filePath, nil, parser.ParseComments)
+	node, err := parser.ParseFile(fset, filePath, src, parser.ParseComments)
 	if err != nil {
-		return fmt.Errorf("failed to parse file %s: %v", filePath, err)
+		return nil, fmt.Errorf("failed to parse file %s: %v", filePath, err)
 	}
 
 	// Get relative path for source reference
@@ -553,17 +568,125 @@ func processFile(filePath string, ts *TranslationSet) error {
 	}
 
 	// Walk the AST
+	var entries []extractedEntry
 	ast.Inspect(node, func(n ast.Node) bool {
 		if call, ok := n.(*ast.CallExpr); ok {
 			msgid, msgidPlural, function, ok := extractTranslationFromCall(call, fset, relPath, currentPackage)
 			if ok {
 				pos := fset.Position(call.Pos())
-				ts.Add(msgid, msgidPlural, relPath, pos.Line, function)
+				entries = append(entries, extractedEntry{
+					MsgID:       msgid,
+					MsgIDPlural: msgidPlural,
+					Line:        pos.Line,
+					Function:    function,
+				})
 			}
 		}
 		return true
 	})
 
+	return entries, nil
+}
+
+// fileExtraction caches the entries extracted from one file keyed by the
+// content hash, so unchanged files are skipped on incremental runs
+type fileExtraction struct {
+	Hash    string           `json:"hash"`
+	Entries []extractedEntry `json:"entries"`
+}
+
+// extractionCache maps relative file paths to their cached extractions
+type extractionCache struct {
+	Files map[string]fileExtraction `json:"files"`
+}
+
+func loadExtractionCache(path string) *extractionCache {
+	cache := &extractionCache{Files: make(map[string]fileExtraction)}
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return cache
+	}
+	if err := json.Unmarshal(data, cache); err != nil || cache.Files == nil {
+		return &extractionCache{Files: make(map[string]fileExtraction)}
+	}
+	return cache
+}
+
+func saveExtractionCache(path string, cache *extractionCache) {
+	data, err := json.MarshalIndent(cache, "", "\t")
+	if err != nil {
+		return
+	}
+	os.WriteFile(path, data, 0644)
+}
+
+// extractAll processes the files with a worker pool, reusing cached
+// results for files whose content hash is unchanged, and merges the
+// per-file entries into the set in sorted file order so the output stays
+// deterministic regardless of worker scheduling
+func extractAll(paths []string, cachePath string, ts *TranslationSet) error {
+	sort.Strings(paths)
+	cache := loadExtractionCache(cachePath)
+	newCache := &extractionCache{Files: make(map[string]fileExtraction)}
+
+	results := make([][]extractedEntry, len(paths))
+	errs := make([]error, len(paths))
+
+	var mu sync.Mutex
+	var wg sync.WaitGroup
+	jobs := make(chan int)
+	workers := runtime.GOMAXPROCS(0)
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for i := range jobs {
+				path := paths[i]
+				src, err := os.ReadFile(path)
+				if err != nil {
+					errs[i] = err
+					continue
+				}
+				hash := fmt.Sprintf("%x", sha256.Sum256(src))
+
+				mu.Lock()
+				cached, ok := cache.Files[path]
+				mu.Unlock()
+				if ok && cached.Hash == hash {
+					results[i] = cached.Entries
+				} else {
+					results[i], errs[i] = processFile(path, src)
+				}
+
+				if errs[i] == nil {
+					mu.Lock()
+					newCache.Files[path] = fileExtraction{Hash: hash, Entries: results[i]}
+					mu.Unlock()
+				}
+			}
+		}()
+	}
+	for i := range paths {
+		jobs <- i
+	}
+	close(jobs)
+	wg.Wait()
+
+	// Merge in sorted file order
+	for i, path := range paths {
+		if errs[i] != nil {
+			return errs[i]
+		}
+		relPath, err := filepath.Rel(".", path)
+		if err != nil {
+			relPath = path
+		}
+		for _, entry := range results[i] {
+			ts.Add(entry.MsgID, entry.MsgIDPlural, relPath, entry.Line, entry.Function)
+		}
+	}
+
+	saveExtractionCache(cachePath, newCache)
 	return nil
 }
 
@@ -574,12 +697,25 @@ func main() {
 		locale     = flag.String("locale", "en_US", "Locale code for the .po file (default: en_US)")
 		directory  = flag.String("d", ".", "Directory to scan for Go files")
 		slimMode   = flag.Bool("slim", false, "Slim mode: only show file name (not line numbers) when same string appears multiple times in the same file")
+		compileDir = flag.String("compile", "", "Compile every locale's .po file under the given locales directory into binary catalogs (pi-apps.pamc) and exit")
+		cachePath  = flag.String("cache", ".xgotext-cache.json", "Extraction cache file; files whose content hash is unchanged are not re-parsed")
 	)
 	flag.Parse()
 
+	// Compile mode: flatten the .po catalogs into the mmap-able binary
+	// format read by the API's translation functions
+	if *compileDir != "" {
+		if err := compileLocaleCatalogs(*compileDir); err != nil {
+			fmt.Fprintf(os.Stderr, "Error compiling catalogs: %v\n", err)
+			os.Exit(1)
+		}
+		return
+	}
+
 	ts := NewTranslationSet()
 
-	// Walk directory and process all .go files
+	// Collect all .go files, then extract with a worker pool
+	var goFiles []string
 	err := filepath.Walk(*directory, func(path string, info os.FileInfo, err error) error {
 		if err != nil {
 			return err
@@ -607,9 +743,13 @@ func main() {
 			return nil
 		}
 
-		return processFile(path, ts)
+		goFiles = append(goFiles, path)
+		return nil
 	})
 
+	if err == nil {
+		err = extractAll(goFiles, *cachePath, ts)
+	}
 	if err != nil {
 		fmt.Fprintf(os.Stderr, "Error processing files: %v\n", err)
 		os.Exit(1)
@@ -632,3 +772,32 @@ func main() {
 		fmt.Printf("Successfully generated English translations to %s\n", *poPath)
 	}
 }
+
+// compileLocaleCatalogs compiles locales/<locale>/LC_MESSAGES/pi-apps.po
+// into the binary catalog format next to it
+func compileLocaleCatalogs(localesDir string) error {
+	entries, err := os.ReadDir(localesDir)
+	if err != nil {
+		return err
+	}
+
+	compiled := 0
+	for _, entry := range entries {
+		if !entry.IsDir() {
+			continue
+		}
+		poPath := filepath.Join(localesDir, entry.Name(), "LC_MESSAGES", "pi-apps.po")
+		if _, err := os.Stat(poPath); err != nil {
+			continue
+		}
+		outPath := filepath.Join(localesDir, entry.Name(), "LC_MESSAGES", "pi-apps.pamc")
+		if err := api.CompileMessageCatalog(poPath, outPath); err != nil {
+			return fmt.Errorf("locale %s: %w", entry.Name(), err)
+		}
+		fmt.Printf("Compiled %s -> %s\n", poPath, outPath)
+		compiled++
+	}
+
+	fmt.Printf("Successfully compiled %d locale catalog(s)\n", compiled)
+	return nil
+}
@@ -24,7 +24,6 @@ import (
 	"crypto/sha1"
 	"encoding/hex"
 	"fmt"
-	"net/http"
 	"os"
 	"os/exec"
 	"path/filepath"
@@ -35,104 +34,37 @@ import (
 
 // ShlinkLink sends anonymous analytics data when an app is installed or uninstalled
 // to track app popularity. No personally identifiable information is sent.
+//
+// The event is appended to a local spool file immediately and delivered by a
+// background flusher with retry/backoff, so the install flow never blocks on
+// a slow or unreachable analytics endpoint. Events spooled while offline are
+// sent the next time an analytics event fires with connectivity.
 func ShlinkLink(app, trigger string) error {
-	// Run in a goroutine to avoid blocking the caller
-	go func() {
-		// Check if analytics are enabled
-		directory := GetPiAppsDir()
-		if directory == "" {
-			ErrorT("ShlinkLink(): PI_APPS_DIR environment variable not set")
-			return
-		}
-
-		settingsPath := filepath.Join(directory, "data", "settings", "Enable analytics")
-		settingsData, err := os.ReadFile(settingsPath)
-		if err == nil && strings.TrimSpace(string(settingsData)) == "No" {
-			// Analytics are disabled
-			return
-		}
-
-		// Get device information
-		model, socID := getModel()
-		kernelVersion := getKernelVersion()
-		machineID := getHashedFileContent("/etc/machine-id")
-		serialNumber := getHashedFileContent("/sys/firmware/devicetree/base/serial-number")
-		osName := getOSName()
-		arch := getArchitecture()
-
-		// Sanitize app name for URL
-		sanitizedApp := sanitizeAppName(app)
-
-		// Create the URL
-		url := fmt.Sprintf("https://analytics.pi-apps.io/pi-apps-%s-%s/track", trigger, sanitizedApp)
-
-		// Create the user agent string
-		userAgent := fmt.Sprintf("Pi-Apps Go Raspberry Pi app store; %s; %s; %s; %s; %s; %s; %s",
-			model, socID, machineID, serialNumber, osName, arch, kernelVersion)
-
-		// Make the request
-		client := &http.Client{
-			Timeout: 10 * time.Second,
-		}
-		req, err := http.NewRequest("GET", url, nil)
-		if err != nil {
-			DebugTf("ShlinkLink: Error creating request: %v", err)
-			return
-		}
-
-		req.Header.Set("User-Agent", userAgent)
-		req.Header.Set("Accept", "image/gif")
+	// Check if analytics are enabled
+	directory := GetPiAppsDir()
+	if directory == "" {
+		ErrorT("ShlinkLink(): PI_APPS_DIR environment variable not set")
+		return nil
+	}
 
-		resp, err := client.Do(req)
-		if err != nil {
-			DebugTf("ShlinkLink: Error making request: %v", err)
-			return
-		}
-		defer resp.Body.Close()
+	settingsPath := filepath.Join(directory, "data", "settings", "Enable analytics")
+	settingsData, err := os.ReadFile(settingsPath)
+	if err == nil && strings.TrimSpace(string(settingsData)) == "No" {
+		// Analytics are disabled
+		return nil
+	}
 
-		// We don't need to do anything with the response
-		// For debugging purposes we could add a DEBUG log message if anything were to go wrong
-	}()
+	spoolAnalyticsEvent(directory, analyticsEvent{
+		App:     app,
+		Trigger: trigger,
+		Time:    time.Now().Unix(),
+	})
 
 	return nil
 }
 
 // Helper functions
 
-// getModel returns the device model and SOC_ID
-//
-//	model - device model
-//	socID - SOC_ID
-func getModel() (string, string) {
-	var model, socID string
-
-	// Read /proc/cpuinfo file
-	cpuInfo, err := os.ReadFile("/proc/cpuinfo")
-	if err != nil {
-		return "", ""
-	}
-
-	// Convert to string and split into lines
-	lines := strings.SplitSeq(string(cpuInfo), "\n")
-
-	// Find model and hardware info
-	for line := range lines {
-		if strings.HasPrefix(line, "Model") {
-			model = strings.TrimPrefix(line, "Model")
-			model = strings.TrimPrefix(model, ":")
-			model = strings.TrimSpace(model)
-			model = strings.Trim(model, `"';`)
-		} else if strings.HasPrefix(line, "Hardware") {
-			socID = strings.TrimPrefix(line, "Hardware")
-			socID = strings.TrimPrefix(socID, ":")
-			socID = strings.TrimSpace(socID)
-			socID = strings.Trim(socID, `"';`)
-		}
-	}
-
-	return model, socID
-}
-
 // getKernelVersion returns the kernel version
 func getKernelVersion() string {
 	cmd := exec.Command("uname", "-r")
@@ -0,0 +1,199 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: analytics_queue.go
+// Description: Asynchronous delivery for analytics events. Events are
+// appended to a spool file in data/ and flushed in batches by a background
+// goroutine with retry/backoff; the user agent is built from the shared
+// boot-scoped device-facts cache, so analytics never add latency to the
+// install flow.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"bufio"
+	"encoding/json"
+	"fmt"
+	"net/http"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+	"time"
+)
+
+const (
+	analyticsSpoolName = "analytics-queue"
+
+	analyticsFlushBackoffMin = 30 * time.Second
+	analyticsFlushBackoffMax = 10 * time.Minute
+)
+
+// analyticsEvent is one spooled install/uninstall event
+type analyticsEvent struct {
+	App     string `json:"app"`
+	Trigger string `json:"trigger"`
+	Time    int64  `json:"time"`
+}
+
+// Spool state shared between callers and the background flusher
+var (
+	analyticsMu        sync.Mutex
+	analyticsFlushOnce sync.Once
+	analyticsKick      = make(chan struct{}, 1)
+)
+
+// spoolAnalyticsEvent appends the event to the spool file and wakes the
+// background flusher. Appending is local I/O only, so callers on the
+// install path never wait on the network.
+func spoolAnalyticsEvent(directory string, event analyticsEvent) {
+	line, err := json.Marshal(event)
+	if err != nil {
+		return
+	}
+
+	analyticsMu.Lock()
+	spoolPath := filepath.Join(directory, "data", analyticsSpoolName)
+	if file, err := os.OpenFile(spoolPath, os.O_APPEND|os.O_CREATE|os.O_WRONLY, 0644); err == nil {
+		fmt.Fprintf(file, "%s\n", line)
+		file.Close()
+	}
+	analyticsMu.Unlock()
+
+	analyticsFlushOnce.Do(func() {
+		go analyticsFlushLoop(directory)
+	})
+
+	// Coalescing wake-up; a flush is already pending if the channel is full
+	select {
+	case analyticsKick <- struct{}{}:
+	default:
+	}
+}
+
+// analyticsFlushLoop drains the spool whenever woken, backing off between
+// attempts while the endpoint is unreachable
+func analyticsFlushLoop(directory string) {
+	backoff := analyticsFlushBackoffMin
+
+	for range analyticsKick {
+		for {
+			events := takeSpooledEvents(directory)
+			if len(events) == 0 {
+				backoff = analyticsFlushBackoffMin
+				break
+			}
+
+			remaining := sendAnalyticsEvents(events)
+			if len(remaining) == 0 {
+				// All delivered; loop once more in case events were
+				// spooled while sending
+				backoff = analyticsFlushBackoffMin
+				continue
+			}
+
+			// Requeue what failed and wait before the next attempt
+			for _, event := range remaining {
+				spoolOnly(directory, event)
+			}
+			time.Sleep(backoff)
+			backoff *= 2
+			if backoff > analyticsFlushBackoffMax {
+				backoff = analyticsFlushBackoffMax
+			}
+		}
+	}
+}
+
+// takeSpooledEvents atomically claims and parses the current spool contents
+func takeSpooledEvents(directory string) []analyticsEvent {
+	analyticsMu.Lock()
+	defer analyticsMu.Unlock()
+
+	spoolPath := filepath.Join(directory, "data", analyticsSpoolName)
+	data, err := os.ReadFile(spoolPath)
+	if err != nil || len(data) == 0 {
+		return nil
+	}
+	os.Remove(spoolPath)
+
+	var events []analyticsEvent
+	scanner := bufio.NewScanner(strings.NewReader(string(data)))
+	for scanner.Scan() {
+		var event analyticsEvent
+		if err := json.Unmarshal(scanner.Bytes(), &event); err == nil {
+			events = append(events, event)
+		}
+	}
+	return events
+}
+
+// spoolOnly re-appends a failed event without waking the flusher again
+func spoolOnly(directory string, event analyticsEvent) {
+	line, err := json.Marshal(event)
+	if err != nil {
+		return
+	}
+
+	analyticsMu.Lock()
+	defer analyticsMu.Unlock()
+	spoolPath := filepath.Join(directory, "data", analyticsSpoolName)
+	if file, err := os.OpenFile(spoolPath, os.O_APPEND|os.O_CREATE|os.O_WRONLY, 0644); err == nil {
+		fmt.Fprintf(file, "%s\n", line)
+		file.Close()
+	}
+}
+
+// sendAnalyticsEvents delivers a batch of events and returns the ones that
+// failed and should be retried
+func sendAnalyticsEvents(events []analyticsEvent) []analyticsEvent {
+	userAgent := analyticsUserAgent()
+	client := &http.Client{
+		Timeout: 10 * time.Second,
+	}
+
+	var failed []analyticsEvent
+	for _, event := range events {
+		url := fmt.Sprintf("https://analytics.pi-apps.io/pi-apps-%s-%s/track", event.Trigger, sanitizeAppName(event.App))
+		req, err := http.NewRequest("GET", url, nil)
+		if err != nil {
+			DebugTf("ShlinkLink: Error creating request: %v", err)
+			continue
+		}
+
+		req.Header.Set("User-Agent", userAgent)
+		req.Header.Set("Accept", "image/gif")
+
+		resp, err := client.Do(req)
+		if err != nil {
+			DebugTf("ShlinkLink: Error making request: %v", err)
+			failed = append(failed, event)
+			continue
+		}
+		resp.Body.Close()
+	}
+	return failed
+}
+
+// analyticsUserAgent builds the analytics user agent from the shared
+// device-facts cache (see device_facts.go)
+func analyticsUserAgent() string {
+	facts := getDeviceFacts()
+	return fmt.Sprintf("Pi-Apps Go Raspberry Pi app store; %s; %s; %s; %s; %s; %s; %s",
+		facts.Model, facts.SocID, facts.MachineID, facts.SerialNumber,
+		facts.OSName, facts.Arch, facts.KernelVersion)
+}
@@ -0,0 +1,107 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: ansi_strip.go
+// Description: Streaming byte-level ANSI escape stripper. Unlike the regex
+// approach it carries its state across Write calls, so escape sequences
+// split between chunks of script output are still removed, and it
+// allocates nothing per chunk once the scratch buffer has grown.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import "io"
+
+// Parser states for the ANSI stripper
+const (
+	ansiGround byte = iota // copying ordinary bytes
+	ansiEscape             // saw ESC, deciding the sequence type
+	ansiCSI                // inside ESC[ ... , consuming until the final byte
+	ansiOSC                // inside ESC] ... , consuming until BEL or ESC\
+)
+
+// ansiState carries the stripper's parser state across calls so escape
+// sequences split between chunks are handled correctly
+type ansiState struct {
+	state byte
+}
+
+// strip appends the printable bytes of p to dst, dropping any ANSI escape
+// sequences, and returns the extended slice
+func (s *ansiState) strip(dst, p []byte) []byte {
+	for _, c := range p {
+		switch s.state {
+		case ansiGround:
+			if c == 0x1b {
+				s.state = ansiEscape
+			} else {
+				dst = append(dst, c)
+			}
+		case ansiEscape:
+			switch c {
+			case '[':
+				s.state = ansiCSI
+			case ']':
+				s.state = ansiOSC
+			case 0x1b:
+				// Stay in escape state for a repeated ESC
+			default:
+				// Two-character sequence (e.g. ESC c); drop it
+				s.state = ansiGround
+			}
+		case ansiCSI:
+			// Parameter and intermediate bytes are 0x20-0x3f; the final
+			// byte 0x40-0x7e terminates the sequence
+			if c >= 0x40 && c <= 0x7e {
+				s.state = ansiGround
+			}
+		case ansiOSC:
+			// Terminated by BEL or the ESC of an ESC\ string terminator
+			if c == 0x07 {
+				s.state = ansiGround
+			} else if c == 0x1b {
+				s.state = ansiEscape
+			}
+		}
+	}
+	return dst
+}
+
+// stripAnsiString removes ANSI escape sequences from a complete string
+func stripAnsiString(s string) string {
+	var state ansiState
+	return string(state.strip(make([]byte, 0, len(s)), []byte(s)))
+}
+
+// AnsiStripWriter wraps an io.Writer and strips ANSI escape sequences before writing
+type AnsiStripWriter struct {
+	writer io.Writer
+	state  ansiState
+	buf    []byte // scratch buffer reused across Write calls
+}
+
+// NewAnsiStripWriter creates a new AnsiStripWriter
+func NewAnsiStripWriter(w io.Writer) *AnsiStripWriter {
+	return &AnsiStripWriter{writer: w}
+}
+
+// Write implements io.Writer interface, stripping ANSI codes before writing
+func (w *AnsiStripWriter) Write(p []byte) (n int, err error) {
+	w.buf = w.state.strip(w.buf[:0], p)
+	_, err = w.writer.Write(w.buf)
+	// Return the original length to satisfy the io.Writer interface
+	return len(p), err
+}
@@ -376,8 +376,7 @@ func LessApt(input string) string {
 
 // stripAnsiCodes removes ANSI color and formatting codes from a string
 func stripAnsiCodes(s string) string {
-	re := regexp.MustCompile(`\x1b\[[0-9;]*[a-zA-Z]`)
-	return re.ReplaceAllString(s, "")
+	return stripAnsiString(s)
 }
 
 // AptUpdate runs an apk update with error-checking and minimal output
@@ -939,8 +938,37 @@ func PurgePackages(app string, isUpdate bool) error {
 	return nil
 }
 
+// installedPackageVersions returns a fingerprint of the installed versions
+// of the given packages, "" when none of them is installed
+func installedPackageVersions(packages []string) string {
+	var versions []string
+	for _, pkg := range packages {
+		cmd := exec.Command("apk", "list", "--installed", pkg)
+		cmd.Env = append(os.Environ(), "LANG=C", "LC_ALL=C")
+		output, err := cmd.Output()
+		if err != nil {
+			continue
+		}
+		if line := strings.TrimSpace(string(output)); line != "" {
+			versions = append(versions, strings.Fields(line)[0])
+		}
+	}
+	return strings.Join(versions, "\n")
+}
+
 // GetIconFromPackage finds the largest icon file (png or svg) installed by a package
 func GetIconFromPackage(packages ...string) (string, error) {
+	// Short-circuit to the cached icon when one was already extracted for
+	// these packages at their currently installed versions
+	directory := GetPiAppsDir()
+	cacheKey := strings.Join(packages, " ")
+	versions := installedPackageVersions(packages)
+	if directory != "" && versions != "" {
+		if icon, ok := lookupPackageIcon(directory, cacheKey, versions); ok {
+			return icon, nil
+		}
+	}
+
 	// Find dependencies that start with the same name as the original packages
 	var extraPackages []string
 	for _, pkg := range packages {
@@ -1050,8 +1078,14 @@ func GetIconFromPackage(packages ...string) (string, error) {
 		return fileSizes[i].Size > fileSizes[j].Size
 	})
 
-	// Return the path of the largest file
+	// Return the path of the largest file, keeping a versioned copy so the
+	// next lookup for these packages skips the hunt entirely
 	if len(fileSizes) > 0 {
+		if directory != "" && versions != "" {
+			if cached, err := storePackageIcon(directory, cacheKey, versions, fileSizes[0].Path); err == nil {
+				return cached, nil
+			}
+		}
 		return fileSizes[0].Path, nil
 	}
 
@@ -557,8 +557,10 @@ func installPackageApp(appName string) error {
 
 	fmt.Fprintf(logFile, "%s %s\n", T("Will install these packages:"), strings.Join(packages, " "))
 
-	// Create ANSI-stripping writer for log file
-	ansiStripLogWriter := NewAnsiStripWriter(logFile)
+	// Persist log output asynchronously, with ANSI codes stripped, so
+	// package manager output is never stalled by slow log file writes
+	logWriter := newAsyncLogWriter(logFile)
+	ansiStripLogWriter := NewAnsiStripWriter(logWriter)
 
 	// Save original stdout/stderr
 	originalStdout := os.Stdout
@@ -600,6 +602,11 @@ func installPackageApp(appName string) error {
 	os.Stdout = originalStdout
 	os.Stderr = originalStderr
 
+	// Drain queued log output before writing outcome messages directly
+	if flushErr := logWriter.Close(); flushErr != nil {
+		fmt.Printf("Warning: failed to write log file %s: %v\n", logPath, flushErr)
+	}
+
 	if err != nil {
 		// Write failure to log file
 		fmt.Fprintf(logFile, "\n%s\n", T("Failed to install the packages!"))
@@ -677,8 +684,10 @@ func uninstallPackageApp(appName string) error {
 	// For package-based apps, we just try to delete the packages directly
 	cmd := exec.Command("sudo", append([]string{"apk", "del", "--no-interactive"}, packages...)...)
 
-	// Create ANSI-stripping writer for log file
-	ansiStripLogWriter := NewAnsiStripWriter(logFile)
+	// Persist log output asynchronously, with ANSI codes stripped, so
+	// package manager output is never stalled by slow log file writes
+	logWriter := newAsyncLogWriter(logFile)
+	ansiStripLogWriter := NewAnsiStripWriter(logWriter)
 
 	var outputBuffer strings.Builder
 	multiWriter := io.MultiWriter(ansiStripLogWriter, os.Stdout, &outputBuffer)
@@ -687,6 +696,11 @@ func uninstallPackageApp(appName string) error {
 
 	err = cmd.Run()
 
+	// Drain queued log output before writing outcome messages directly
+	if flushErr := logWriter.Close(); flushErr != nil {
+		fmt.Printf("Warning: failed to write log file %s: %v\n", logPath, flushErr)
+	}
+
 	// Check for errors in output even if exit code is 0
 	output := outputBuffer.String()
 	if strings.Contains(output, "ERROR:") {
@@ -748,6 +762,13 @@ func installPackageAppDependencies(dependencies ...string) error {
 	return nil
 }
 
+// prefetchPackageAppDependencies pre-downloads the dependencies for a
+// package-based app. apk streams packages directly during add and only
+// reuses downloads when a local cache is enabled, so this is a no-op.
+func prefetchPackageAppDependencies(dependencies ...string) error {
+	return nil
+}
+
 // uninstallPackageAppDependencies uninstalls the dependencies for a package-based app
 func uninstallPackageAppDependencies(dependencies ...string) error {
 	// Uninstall packages with sudo
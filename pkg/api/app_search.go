@@ -174,35 +174,21 @@ func AppSearch(query string, searchFiles ...string) ([]string, error) {
 	// Search for the query in the specified files
 	results := make(map[string]bool) // Use a map to avoid duplicates
 
-	for _, appDir := range listAppDirs(directory) {
-		appName := filepath.Base(appDir)
-
-		// Search in each specified file
-		for _, fileName := range searchFiles {
-			filePath := filepath.Join(appDir, fileName)
-
-			if FileExists(filePath) {
-				// Read and check the file for the query
-				found, err := fileContainsText(filePath, query)
-				if err != nil {
-					DebugTf("Error searching in %s: %v", filePath, err)
-					continue
-				}
-
-				if found {
-					results[appName] = true
-					break // Once found in one file, no need to check other files for this app
-				}
+	// Resolve default searches against the persistent inverted index so
+	// interactive search doesn't re-read every metadata file per keystroke.
+	// Non-default search file selections fall through to the file scan.
+	usedIndex := false
+	if isDefaultSearchFiles(searchFiles) {
+		if index, err := loadSearchIndex(directory); err == nil {
+			for _, app := range index.lookup(query) {
+				results[app] = true
 			}
+			usedIndex = true
 		}
+	}
 
-		// Also check app name for matches
-		appNameLower := strings.ToLower(appName)
-		queryLower := strings.ToLower(query)
-
-		if strings.HasPrefix(appNameLower, queryLower) || strings.Contains(appNameLower, queryLower) {
-			results[appName] = true
-		}
+	if !usedIndex {
+		searchAppFiles(directory, query, searchFiles, results)
 	}
 
 	// Convert map keys to slice
@@ -257,6 +243,41 @@ func AppSearch(query string, searchFiles ...string) ([]string, error) {
 	return filteredResults, nil
 }
 
+// searchAppFiles is the fallback search path: it scans every app's search
+// files directly, recording matches in results
+func searchAppFiles(directory, query string, searchFiles []string, results map[string]bool) {
+	for _, appDir := range listAppDirs(directory) {
+		appName := filepath.Base(appDir)
+
+		// Search in each specified file
+		for _, fileName := range searchFiles {
+			filePath := filepath.Join(appDir, fileName)
+
+			if FileExists(filePath) {
+				// Read and check the file for the query
+				found, err := fileContainsText(filePath, query)
+				if err != nil {
+					DebugTf("Error searching in %s: %v", filePath, err)
+					continue
+				}
+
+				if found {
+					results[appName] = true
+					break // Once found in one file, no need to check other files for this app
+				}
+			}
+		}
+
+		// Also check app name for matches
+		appNameLower := strings.ToLower(appName)
+		queryLower := strings.ToLower(query)
+
+		if strings.HasPrefix(appNameLower, queryLower) || strings.Contains(appNameLower, queryLower) {
+			results[appName] = true
+		}
+	}
+}
+
 // fileContainsText returns true if the file contains the given text (case-insensitive)
 //
 //	false - file does not contain text
@@ -598,8 +619,11 @@ func showSearchResults(directory string, results []string, query string) string
 	rowToAppMap := make(map[int]string)
 	rowIndex := 0
 
-	// Add results to the list box
-	for _, app := range results {
+	// Add results to the list box lazily: the first screenful is built
+	// before the window shows, the rest in idle batches once gtk.Main runs
+	ListBoxPopulateLazily(listBox, len(results), nil, func(index int) (*gtk.ListBoxRow, error) {
+		app := results[index]
+
 		// Find category for the app
 		category := "Other"
 		for _, entry := range categoryEntries {
@@ -614,7 +638,7 @@ func showSearchResults(directory string, results []string, query string) string
 		rowBox, err := gtk.BoxNew(gtk.ORIENTATION_HORIZONTAL, 10)
 		if err != nil {
 			DebugTf("Error creating row box: %v", err)
-			continue
+			return nil, err
 		}
 		rowBox.SetMarginStart(10)
 		rowBox.SetMarginEnd(10)
@@ -633,7 +657,7 @@ func showSearchResults(directory string, results []string, query string) string
 		appLabel, err := gtk.LabelNew(app)
 		if err != nil {
 			DebugTf("Error creating app label: %v", err)
-			continue
+			return nil, err
 		}
 		rowBox.PackStart(appLabel, false, false, 0)
 
@@ -641,7 +665,7 @@ func showSearchResults(directory string, results []string, query string) string
 		spacer, err := gtk.BoxNew(gtk.ORIENTATION_HORIZONTAL, 0)
 		if err != nil {
 			DebugTf("Error creating spacer: %v", err)
-			continue
+			return nil, err
 		}
 		rowBox.PackStart(spacer, true, true, 0)
 
@@ -649,7 +673,7 @@ func showSearchResults(directory string, results []string, query string) string
 		inLabel, err := gtk.LabelNew("in")
 		if err != nil {
 			DebugTf("Error creating 'in' label: %v", err)
-			continue
+			return nil, err
 		}
 		inLabel.SetSizeRequest(20, -1)
 		rowBox.PackStart(inLabel, false, false, 0)
@@ -666,7 +690,7 @@ func showSearchResults(directory string, results []string, query string) string
 		categoryLabel, err := gtk.LabelNew(category)
 		if err != nil {
 			DebugTf("Error creating category label: %v", err)
-			continue
+			return nil, err
 		}
 		rowBox.PackStart(categoryLabel, false, false, 0)
 
@@ -674,17 +698,18 @@ func showSearchResults(directory string, results []string, query string) string
 		row, err := gtk.ListBoxRowNew()
 		if err != nil {
 			DebugTf("Error creating list box row: %v", err)
-			continue
+			return nil, err
 		}
 		row.Add(rowBox)
 		row.SetTooltipText(getAppDescription(directory, app))
 
-		// Store app name in the map with this row's index
+		// Store app name keyed by this row's index; rowIndex only counts
+		// rows actually added, so it matches GetIndex in the handler
 		rowToAppMap[rowIndex] = app
 		rowIndex++
 
-		listBox.Add(row)
-	}
+		return row, nil
+	})
 
 	scrolledWindow.Add(listBox)
 	mainBox.PackStart(scrolledWindow, true, true, 0)
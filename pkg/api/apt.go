@@ -264,6 +264,51 @@ func AptLockWait() error {
 	return nil
 }
 
+// aptNoisePatterns are the apt output lines the user does not need to see
+var aptNoisePatterns = []string{
+	"apt does not have a stable CLI interface.",
+	"Reading package lists...",
+	"Building dependency tree",
+	"Reading state information...",
+	"Need to get",
+	"Selecting previously unselected package",
+	"Preparing to unpack",
+	"Setting up ",
+	"Processing triggers for ",
+	"^$",
+	// Additional patterns for APT 3.0
+	"The following packages were automatically installed",
+	"Unpacking",
+	"Get:",
+	"Summary:",
+	"Upgrading:",
+	"Download size:",
+	"Space needed:",
+	"Space reclaimed:",
+	"After this operation", // Line about disk space (present in both APT 2.x and 3.0)
+	"Fetched",              // Line about download size and speed
+	"Preparing to unpack",
+	"Extracting templates",
+	"Removing old",
+}
+
+// aptNoiseLine reports whether one already-ANSI-stripped line of apt output
+// is noise. Repository lines (Hit:/Ign:/Get:) are always kept so no PPA is
+// missed, even though "Get:" also appears in the noise patterns.
+func aptNoiseLine(line string) bool {
+	if strings.HasPrefix(line, "Hit:") ||
+		strings.HasPrefix(line, "Ign:") ||
+		strings.HasPrefix(line, "Get:") {
+		return false
+	}
+	for _, pattern := range aptNoisePatterns {
+		if strings.Contains(line, pattern) {
+			return true
+		}
+	}
+	return false
+}
+
 // LessApt filters out unwanted lines from apt output
 //
 // This is a helper function for apt-related operations
@@ -273,33 +318,6 @@ func LessApt(input string) string {
 	// before doing any pattern matching
 	input = stripAnsiCodes(input)
 
-	unwantedPatterns := []string{
-		"apt does not have a stable CLI interface.",
-		"Reading package lists...",
-		"Building dependency tree",
-		"Reading state information...",
-		"Need to get",
-		"Selecting previously unselected package",
-		"Preparing to unpack",
-		"Setting up ",
-		"Processing triggers for ",
-		"^$",
-		// Additional patterns for APT 3.0
-		"The following packages were automatically installed",
-		"Unpacking",
-		"Get:",
-		"Summary:",
-		"Upgrading:",
-		"Download size:",
-		"Space needed:",
-		"Space reclaimed:",
-		"After this operation", // Line about disk space (present in both APT 2.x and 3.0)
-		"Fetched",              // Line about download size and speed
-		"Preparing to unpack",
-		"Extracting templates",
-		"Removing old",
-	}
-
 	lines := strings.Split(input, "\n")
 	var filteredLines []string
 
@@ -307,26 +325,7 @@ func LessApt(input string) string {
 		if line == "" {
 			continue // Skip empty lines
 		}
-
-		keep := true
-
-		// Special handling for repository lines to ensure we don't miss any PPAs
-		if strings.HasPrefix(line, "Hit:") ||
-			strings.HasPrefix(line, "Ign:") ||
-			strings.HasPrefix(line, "Get:") {
-			// Always keep repository lines
-			filteredLines = append(filteredLines, line)
-			continue
-		}
-
-		for _, pattern := range unwantedPatterns {
-			if strings.Contains(line, pattern) {
-				keep = false
-				break
-			}
-		}
-
-		if keep {
+		if !aptNoiseLine(line) {
 			filteredLines = append(filteredLines, line)
 		}
 	}
@@ -343,10 +342,7 @@ func LessApt(input string) string {
 // stripAnsiCodes removes ANSI color and formatting codes from a string
 // This is useful for processing the output of commands like apt that might include color codes
 func stripAnsiCodes(s string) string {
-	// ANSI escape sequences typically start with ESC (0x1B) followed by '[' and then some sequence
-	// This regex matches all ANSI escape sequences used for colors and formatting
-	re := regexp.MustCompile(`\x1b\[[0-9;]*[a-zA-Z]`)
-	return re.ReplaceAllString(s, "")
+	return stripAnsiString(s)
 }
 
 // fetchGPGKeyFromKeyserver retrieves a GPG key from a keyserver using HTTP
@@ -475,92 +471,52 @@ func AptUpdate(args ...string) error {
 		return fmt.Errorf("failed to start apt update command: %w", err)
 	}
 
-	// Create a buffer to store the complete output
-	var outputBuffer bytes.Buffer
-	outputWriter := io.MultiWriter(os.Stderr, &outputBuffer)
-
-	// Read output and buffer it to process complete lines
+	// Classify, filter and forward the output one line at a time: the user
+	// sees progress as each repository is contacted, and the findings come
+	// out of the stream as structured events instead of whole-output scans
+	// after apt exits
+	stream := newAptUpdateStream(os.Stderr)
 	scanner := bufio.NewScanner(outputReader)
-	var buffer string
 	for scanner.Scan() {
-		line := scanner.Text()
-
-		// Add line to our processing buffer
-		buffer += line + "\n"
-
-		// If we have a complete line or multiple lines, process them
-		if strings.Contains(buffer, "\n") {
-			lines := strings.Split(buffer, "\n")
-			// Process all complete lines
-			for i := 0; i < len(lines)-1; i++ {
-				if lines[i] != "" {
-					filteredLine := LessApt(lines[i] + "\n")
-					if filteredLine != "" {
-						fmt.Fprint(outputWriter, filteredLine)
-					}
-				}
-			}
-			// Keep any partial line for the next iteration
-			buffer = lines[len(lines)-1]
-		}
-	}
-
-	// Process any remaining content in the buffer
-	if buffer != "" {
-		filteredLine := LessApt(buffer)
-		if filteredLine != "" {
-			fmt.Fprint(outputWriter, filteredLine)
-		}
+		stream.ProcessLine(scanner.Text())
 	}
 
 	// Wait for the command to complete
 	err = cmd.Wait()
 
-	// Process output to show helpful messages
-	// Strip color codes first to ensure reliable pattern matching
-	completeOutput := outputBuffer.String()
-	strippedOutput := stripAnsiCodes(completeOutput)
-
 	// Show completion message in cyan to match the original
 	fmt.Fprintf(os.Stderr, "\033[96m%s\033[0m\n", T("apt update complete."))
 
 	// Check for autoremovable packages messages (both APT 2.x and 3.0 formats)
-	if strings.Contains(strippedOutput, "autoremove to remove them") ||
-		strings.Contains(strippedOutput, "can be autoremoved") {
+	if stream.autoremovable {
 		// Use direct ANSI codes for exact matching with the original
 		fmt.Printf("\033[33m%s\033[39m %s \033[4msudo a\033[0mp\033[4mt autoremove\033[0m.\n",
 			T("Some packages are unnecessary."), T("Please consider running"))
 	}
 
 	// Check for upgradeable packages messages (both APT 2.x and 3.0 formats)
-	if strings.Contains(strippedOutput, "packages can be upgraded") ||
-		strings.Contains(strippedOutput, "can be upgraded") ||
-		strings.Contains(strippedOutput, "upgradable") {
+	if stream.upgradableMany {
 		fmt.Printf("\033[33m%s\033[39m %s \033[4msudo a\033[0mp\033[4mt full-u\033[0mpg\033[4mrade\033[0m.\n",
 			T("Some packages can be upgraded."), T("Please consider running"))
-	} else if strings.Contains(strippedOutput, "package can be upgraded") ||
-		strings.Contains(strippedOutput, "is upgradable") {
+	} else if stream.upgradableOne {
 		fmt.Printf("\033[33m%s\033[39m %s \033[4msudo a\033[0mp\033[4mt full-u\033[0mpg\033[4mrade\033[0m.\n",
 			T("One package can be upgraded."), T("Please consider running"))
 	}
 
 	// Handle errors
-	if err != nil || strings.Contains(completeOutput, "Err:") || strings.Contains(completeOutput, "E:") {
-		// Extract error messages
-		var errorLines []string
-		lines := strings.Split(completeOutput, "\n")
-		for _, line := range lines {
-			if strings.HasPrefix(strings.TrimSpace(line), "E:") || strings.HasPrefix(strings.TrimSpace(line), "Err:") {
-				errorLines = append(errorLines, line)
-			}
-		}
-
-		errorMessage := strings.Join(errorLines, "\n")
+	if err != nil || stream.failed {
+		errorMessage := strings.Join(stream.errorLines(), "\n")
 		fmt.Fprintf(os.Stderr, "\033[91m%s \033[4msudo apt update\033[0m\033[39m!\n", T("Failed to run"))
 		fmt.Fprintf(os.Stderr, "%s\n\033[91m%s\033[39m\n", T("APT reported these errors:"), errorMessage)
 
+		// Repositories whose signatures could not be verified, straight from
+		// the key-missing events
+		if keys := stream.missingKeys(); len(keys) > 0 {
+			fmt.Fprintf(os.Stderr, "%s %s\n", T("Missing repository signing keys:"), strings.Join(keys, " "))
+		}
+
 		// Print the full output for diagnosis
-		fmt.Fprintln(os.Stderr, completeOutput)
+		fmt.Fprintln(os.Stderr, stream.output())
 
 		if err != nil {
 			return fmt.Errorf("apt update failed with exit code %d: %w", cmd.ProcessState.ExitCode(), err)
@@ -1558,9 +1514,31 @@ func PurgePackages(app string, isUpdate bool) error {
 	return nil
 }
 
+// installedPackageVersions returns a fingerprint of the installed versions
+// of the given packages, "" when none of them is installed
+func installedPackageVersions(packages []string) string {
+	args := append([]string{"-W", "-f", "${Package} ${Version}\n"}, packages...)
+	cmd := exec.Command("dpkg-query", args...)
+	cmd.Env = append(os.Environ(), "LANG=en_US.UTF-8", "LC_ALL=en_US.UTF-8")
+	// Ignore the exit status: partial output still identifies the installed subset
+	output, _ := cmd.Output()
+	return strings.TrimSpace(string(output))
+}
+
 // GetIconFromPackage finds the largest icon file (png or svg) installed by a package
 // This is a Go implementation of the original bash get_icon_from_package function
 func GetIconFromPackage(packages ...string) (string, error) {
+	// Short-circuit to the cached icon when one was already extracted for
+	// these packages at their currently installed versions
+	directory := GetPiAppsDir()
+	cacheKey := strings.Join(packages, " ")
+	versions := installedPackageVersions(packages)
+	if directory != "" && versions != "" {
+		if icon, ok := lookupPackageIcon(directory, cacheKey, versions); ok {
+			return icon, nil
+		}
+	}
+
 	// Find dependencies that start with the same name as the original packages
 	var extraPackages []string
 	for _, pkg := range packages {
@@ -1661,8 +1639,14 @@ func GetIconFromPackage(packages ...string) (string, error) {
 		return fileSizes[i].Size > fileSizes[j].Size
 	})
 
-	// Return the path of the largest file
+	// Return the path of the largest file, keeping a versioned copy so the
+	// next lookup for these packages skips the hunt entirely
 	if len(fileSizes) > 0 {
+		if directory != "" && versions != "" {
+			if cached, err := storePackageIcon(directory, cacheKey, versions, fileSizes[0].Path); err == nil {
+				return cached, nil
+			}
+		}
 		return fileSizes[0].Path, nil
 	}
 
@@ -2122,6 +2106,12 @@ func AdoptiumInstaller() error {
 
 // PackageInstalled checks if a package is installed
 func PackageInstalled(packageName string) bool {
+	// Answer from the package-state snapshot when available: one parse of
+	// /var/lib/dpkg/status serves every lookup instead of a dpkg fork each
+	if snapshot, err := loadPackageSnapshot(); err == nil {
+		return snapshot.isInstalled(packageName)
+	}
+
 	// Use dpkg to check if the package is installed
 	// Force English locale to ensure consistent error message parsing
 	cmd := exec.Command("dpkg", "-s", packageName)
@@ -2142,6 +2132,12 @@ func PackageInstalled(packageName string) bool {
 
 // PackageAvailable determines if the specified package exists in a local repository
 func PackageAvailable(packageName string, dpkgArch string) bool {
+	// Answer from the package-state snapshot when the apt lists could be
+	// parsed; otherwise fall back to apt-cache
+	if snapshot, err := loadPackageSnapshot(); err == nil && snapshot.hasLists {
+		return snapshot.isAvailable(packageName, dpkgArch)
+	}
+
 	// If dpkgArch is not specified, get the current architecture
 	if dpkgArch == "" {
 		cmd := exec.Command("dpkg", "--print-architecture")
@@ -2221,6 +2217,14 @@ func PackageDependencies(packageName string) ([]string, error) {
 //	"" - package is not installed
 //	version - package is installed
 func PackageInstalledVersion(packageName string) (string, error) {
+	// Answer from the package-state snapshot when available
+	if snapshot, err := loadPackageSnapshot(); err == nil {
+		if version, ok := snapshot.installedVersion(packageName); ok {
+			return version, nil
+		}
+		return "", fmt.Errorf(T("package %s is not installed"), packageName)
+	}
+
 	// Use dpkg to get the installed version
 	// Force English locale to ensure consistent output format
 	cmd := exec.Command("dpkg-query", "-W", "-f=${Version}", packageName)
@@ -2244,6 +2248,17 @@ func PackageLatestVersion(packageName string, repo ...string) (string, error) {
 		additionalFlags = []string{"-t", repo[1]}
 	}
 
+	// Answer from the package-state snapshot when no target release is
+	// requested; -t needs apt's pin logic so it keeps using apt-cache
+	if len(additionalFlags) == 0 {
+		if snapshot, err := loadPackageSnapshot(); err == nil && snapshot.hasLists {
+			if version, ok := snapshot.candidateVersion(packageName); ok {
+				return version, nil
+			}
+			return "", fmt.Errorf("package %s is not available", packageName)
+		}
+	}
+
 	// Get the latest version using apt-cache policy
 	// Force English locale to ensure consistent output parsing
 	var cmd *exec.Cmd
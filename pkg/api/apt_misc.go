@@ -720,8 +720,10 @@ func installPackageApp(appName string) error {
 
 	fmt.Fprintf(logFile, "Will install these packages: %s\n", strings.Join(packages, " "))
 
-	// Create ANSI-stripping writer for log file
-	ansiStripLogWriter := NewAnsiStripWriter(logFile)
+	// Persist log output asynchronously, with ANSI codes stripped, so
+	// package manager output is never stalled by slow log file writes
+	logWriter := newAsyncLogWriter(logFile)
+	ansiStripLogWriter := NewAnsiStripWriter(logWriter)
 
 	// Save original stdout/stderr
 	originalStdout := os.Stdout
@@ -763,6 +765,11 @@ func installPackageApp(appName string) error {
 	os.Stdout = originalStdout
 	os.Stderr = originalStderr
 
+	// Drain queued log output before writing outcome messages directly
+	if flushErr := logWriter.Close(); flushErr != nil {
+		fmt.Printf("Warning: failed to write log file %s: %v\n", logPath, flushErr)
+	}
+
 	if err != nil {
 		// Write failure to log file
 		fmt.Fprintf(logFile, "\nFailed to install the packages!\n")
@@ -838,8 +845,10 @@ func uninstallPackageApp(appName string) error {
 
 	fmt.Fprintf(logFile, "Will uninstall these packages: %s\n", strings.Join(packages, " "))
 
-	// Create ANSI-stripping writer for log file
-	ansiStripLogWriter := NewAnsiStripWriter(logFile)
+	// Persist log output asynchronously, with ANSI codes stripped, so
+	// package manager output is never stalled by slow log file writes
+	logWriter := newAsyncLogWriter(logFile)
+	ansiStripLogWriter := NewAnsiStripWriter(logWriter)
 
 	// Save original stdout/stderr
 	originalStdout := os.Stdout
@@ -881,6 +890,11 @@ func uninstallPackageApp(appName string) error {
 	os.Stdout = originalStdout
 	os.Stderr = originalStderr
 
+	// Drain queued log output before writing outcome messages directly
+	if flushErr := logWriter.Close(); flushErr != nil {
+		fmt.Printf("Warning: failed to write log file %s: %v\n", logPath, flushErr)
+	}
+
 	if err != nil {
 		// Write failure to log file
 		fmt.Fprintf(logFile, "\nFailed to uninstall the packages!\n")
@@ -926,6 +940,22 @@ func installPackageAppDependencies(dependencies ...string) error {
 	return nil
 }
 
+// prefetchPackageAppDependencies downloads the dependencies for a
+// package-based app into the apt archive cache without installing them
+func prefetchPackageAppDependencies(dependencies ...string) error {
+	// Download packages with sudo; the later install reuses the cache
+	cmd := exec.Command("sudo", append([]string{"apt-get", "install", "-yf", "--no-install-recommends", "--download-only"}, dependencies...)...)
+	cmd.Stdout = os.Stdout
+	cmd.Stderr = os.Stderr
+
+	err := cmd.Run()
+	if err != nil {
+		return fmt.Errorf("failed to download dependencies: %v", err)
+	}
+
+	return nil
+}
+
 // uninstallPackageAppDependencies uninstalls the dependencies for a package-based app
 func uninstallPackageAppDependencies(dependencies ...string) error {
 	// Uninstall packages with sudo
@@ -0,0 +1,378 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+//go:build apt
+
+// Module: apt_snapshot.go
+// Description: Process-wide snapshot of the dpkg/apt package state. The
+// dpkg status file and the apt list indexes are parsed once into in-memory
+// maps (invalidated by file mtime), so per-package queries become hash
+// probes instead of dpkg/apt-cache forks.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"bufio"
+	"fmt"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+)
+
+const (
+	dpkgStatusPath = "/var/lib/dpkg/status"
+	aptListsDir    = "/var/lib/apt/lists"
+)
+
+// pkgVersion is one available version of a package in the apt lists
+type pkgVersion struct {
+	Arch    string
+	Version string
+}
+
+// pkgStateSnapshot holds the parsed package state
+type pkgStateSnapshot struct {
+	installed  map[string]string       // package name -> installed version
+	available  map[string][]pkgVersion // package name -> versions in the apt lists
+	nativeArch string
+	hasLists   bool // whether any apt list index could be parsed
+}
+
+// Snapshot cache, invalidated when the dpkg status file or the apt lists
+// directory change
+var (
+	pkgSnapshotMu     sync.Mutex
+	pkgSnapshotCache  *pkgStateSnapshot
+	pkgSnapshotFprint [2]int64
+)
+
+// pkgSnapshotFingerprint fingerprints the package-state sources
+func pkgSnapshotFingerprint() [2]int64 {
+	var fingerprint [2]int64
+	if stat, err := os.Stat(dpkgStatusPath); err == nil {
+		fingerprint[0] = stat.ModTime().Unix() + stat.Size()
+	}
+	fingerprint[1] = dirFingerprint(aptListsDir)
+	return fingerprint
+}
+
+// loadPackageSnapshot returns the current package-state snapshot, reparsing
+// the source files only when they have changed
+func loadPackageSnapshot() (*pkgStateSnapshot, error) {
+	pkgSnapshotMu.Lock()
+	defer pkgSnapshotMu.Unlock()
+
+	current := pkgSnapshotFingerprint()
+	if pkgSnapshotCache != nil && pkgSnapshotFprint == current {
+		return pkgSnapshotCache, nil
+	}
+
+	snapshot, err := buildPackageSnapshot()
+	if err != nil {
+		return nil, err
+	}
+
+	pkgSnapshotCache = snapshot
+	pkgSnapshotFprint = current
+	return snapshot, nil
+}
+
+// buildPackageSnapshot parses the dpkg status file and the apt list indexes
+func buildPackageSnapshot() (*pkgStateSnapshot, error) {
+	arch, err := getDpkgArchitecture()
+	if err != nil {
+		return nil, err
+	}
+
+	snapshot := &pkgStateSnapshot{
+		installed:  make(map[string]string),
+		available:  make(map[string][]pkgVersion),
+		nativeArch: arch,
+	}
+
+	if err := snapshot.parseDpkgStatus(dpkgStatusPath); err != nil {
+		return nil, err
+	}
+
+	// Parse every uncompressed Packages index. Missing or compressed lists
+	// just mean availability queries fall back to apt-cache.
+	if entries, err := os.ReadDir(aptListsDir); err == nil {
+		for _, entry := range entries {
+			if entry.IsDir() || !strings.HasSuffix(entry.Name(), "_Packages") {
+				continue
+			}
+			if err := snapshot.parsePackagesIndex(filepath.Join(aptListsDir, entry.Name())); err == nil {
+				snapshot.hasLists = true
+			}
+		}
+	}
+
+	return snapshot, nil
+}
+
+// parseDpkgStatus records the installed version of every installed package
+func (s *pkgStateSnapshot) parseDpkgStatus(path string) error {
+	file, err := os.Open(path)
+	if err != nil {
+		return fmt.Errorf("error reading dpkg status file: %w", err)
+	}
+	defer file.Close()
+
+	var name, version string
+	installed := false
+
+	flush := func() {
+		if name != "" && installed && version != "" {
+			s.installed[name] = version
+		}
+		name, version, installed = "", "", false
+	}
+
+	scanner := bufio.NewScanner(file)
+	scanner.Buffer(make([]byte, 64*1024), 1024*1024)
+	for scanner.Scan() {
+		line := scanner.Text()
+		switch {
+		case line == "":
+			flush()
+		case strings.HasPrefix(line, "Package: "):
+			name = line[len("Package: "):]
+		case strings.HasPrefix(line, "Status: "):
+			installed = strings.HasSuffix(line, " installed")
+		case strings.HasPrefix(line, "Version: "):
+			version = line[len("Version: "):]
+		}
+	}
+	flush()
+
+	return scanner.Err()
+}
+
+// parsePackagesIndex records every package version listed in one apt index
+func (s *pkgStateSnapshot) parsePackagesIndex(path string) error {
+	file, err := os.Open(path)
+	if err != nil {
+		return err
+	}
+	defer file.Close()
+
+	var name, version, arch string
+
+	flush := func() {
+		if name != "" && version != "" {
+			s.available[name] = append(s.available[name], pkgVersion{Arch: arch, Version: version})
+		}
+		name, version, arch = "", "", ""
+	}
+
+	scanner := bufio.NewScanner(file)
+	scanner.Buffer(make([]byte, 64*1024), 1024*1024)
+	for scanner.Scan() {
+		line := scanner.Text()
+		switch {
+		case line == "":
+			flush()
+		case strings.HasPrefix(line, "Package: "):
+			name = line[len("Package: "):]
+		case strings.HasPrefix(line, "Version: "):
+			version = line[len("Version: "):]
+		case strings.HasPrefix(line, "Architecture: "):
+			arch = line[len("Architecture: "):]
+		}
+	}
+	flush()
+
+	return scanner.Err()
+}
+
+// splitPackageArch splits an optionally architecture-qualified package name
+func splitPackageArch(packageName string) (string, string) {
+	if name, arch, found := strings.Cut(packageName, ":"); found {
+		return name, arch
+	}
+	return packageName, ""
+}
+
+// isInstalled reports whether the package is installed
+func (s *pkgStateSnapshot) isInstalled(packageName string) bool {
+	name, _ := splitPackageArch(packageName)
+	_, ok := s.installed[name]
+	return ok
+}
+
+// installedVersion returns the installed version of the package
+func (s *pkgStateSnapshot) installedVersion(packageName string) (string, bool) {
+	name, _ := splitPackageArch(packageName)
+	version, ok := s.installed[name]
+	return version, ok
+}
+
+// isAvailable reports whether the package exists in the apt lists for the
+// given dpkg architecture ("all" packages match any architecture)
+func (s *pkgStateSnapshot) isAvailable(packageName, dpkgArch string) bool {
+	name, qualifiedArch := splitPackageArch(packageName)
+	if qualifiedArch != "" {
+		dpkgArch = qualifiedArch
+	}
+	if dpkgArch == "" {
+		dpkgArch = s.nativeArch
+	}
+
+	for _, candidate := range s.available[name] {
+		if candidate.Arch == dpkgArch || candidate.Arch == "all" {
+			return true
+		}
+	}
+	return false
+}
+
+// candidateVersion returns the highest version of the package available for
+// the native architecture, approximating apt's candidate selection
+func (s *pkgStateSnapshot) candidateVersion(packageName string) (string, bool) {
+	name, qualifiedArch := splitPackageArch(packageName)
+	arch := qualifiedArch
+	if arch == "" {
+		arch = s.nativeArch
+	}
+
+	best := ""
+	for _, candidate := range s.available[name] {
+		if candidate.Arch != arch && candidate.Arch != "all" {
+			continue
+		}
+		if best == "" || compareDebianVersions(candidate.Version, best) > 0 {
+			best = candidate.Version
+		}
+	}
+	return best, best != ""
+}
+
+// compareDebianVersions compares two Debian version strings per dpkg
+// semantics (epoch:upstream-revision, with '~' sorting before everything).
+// Returns <0, 0, or >0.
+func compareDebianVersions(a, b string) int {
+	epochA, restA := splitEpoch(a)
+	epochB, restB := splitEpoch(b)
+	if epochA != epochB {
+		return epochA - epochB
+	}
+
+	upstreamA, revisionA := splitRevision(restA)
+	upstreamB, revisionB := splitRevision(restB)
+	if cmp := verrevcmp(upstreamA, upstreamB); cmp != 0 {
+		return cmp
+	}
+	return verrevcmp(revisionA, revisionB)
+}
+
+// splitEpoch separates the leading "epoch:" from a version string
+func splitEpoch(version string) (int, string) {
+	if epochStr, rest, found := strings.Cut(version, ":"); found {
+		epoch := 0
+		for _, r := range epochStr {
+			if r < '0' || r > '9' {
+				return 0, version // Not a valid epoch, treat whole string as upstream
+			}
+			epoch = epoch*10 + int(r-'0')
+		}
+		return epoch, rest
+	}
+	return 0, version
+}
+
+// splitRevision separates the trailing "-revision" from a version string
+func splitRevision(version string) (string, string) {
+	if i := strings.LastIndex(version, "-"); i >= 0 {
+		return version[:i], version[i+1:]
+	}
+	return version, ""
+}
+
+// verrevcmp implements dpkg's version fragment comparison
+func verrevcmp(a, b string) int {
+	order := func(c byte) int {
+		switch {
+		case c >= '0' && c <= '9':
+			return 0
+		case (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'):
+			return int(c)
+		case c == '~':
+			return -1
+		default:
+			return int(c) + 256
+		}
+	}
+
+	i, j := 0, 0
+	for i < len(a) || j < len(b) {
+		firstDiff := 0
+
+		// Compare non-digit prefixes
+		for (i < len(a) && !isDigit(a[i])) || (j < len(b) && !isDigit(b[j])) {
+			ac, bc := 0, 0
+			if i < len(a) {
+				ac = order(a[i])
+			}
+			if j < len(b) {
+				bc = order(b[j])
+			}
+			if ac != bc {
+				return ac - bc
+			}
+			if i < len(a) {
+				i++
+			}
+			if j < len(b) {
+				j++
+			}
+		}
+
+		// Skip leading zeros
+		for i < len(a) && a[i] == '0' {
+			i++
+		}
+		for j < len(b) && b[j] == '0' {
+			j++
+		}
+
+		// Compare digit runs
+		for i < len(a) && j < len(b) && isDigit(a[i]) && isDigit(b[j]) {
+			if firstDiff == 0 {
+				firstDiff = int(a[i]) - int(b[j])
+			}
+			i++
+			j++
+		}
+		if i < len(a) && isDigit(a[i]) {
+			return 1
+		}
+		if j < len(b) && isDigit(b[j]) {
+			return -1
+		}
+		if firstDiff != 0 {
+			return firstDiff
+		}
+	}
+
+	return 0
+}
+
+// isDigit reports whether c is an ASCII digit
+func isDigit(c byte) bool {
+	return c >= '0' && c <= '9'
+}
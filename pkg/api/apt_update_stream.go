@@ -0,0 +1,154 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: apt_update_stream.go
+// Description: Line-oriented streaming classifier for `apt update` output.
+// Each line is stripped, classified and forwarded in a single pass as it
+// arrives, so the user sees progress immediately and the findings (failed
+// repositories, missing signing keys, pending upgrades) come out as
+// structured events instead of being re-extracted from the buffered text
+// with whole-output scans after apt exits.
+// SPDX-License-Identifier: GPL-3.0-or-later
+//go:build apt
+
+package api
+
+import (
+	"fmt"
+	"io"
+	"strings"
+)
+
+// aptUpdateEventKind classifies one structured finding from apt update output
+type aptUpdateEventKind int
+
+const (
+	// aptUpdateEventError is an "E:" line — apt reported a hard error
+	aptUpdateEventError aptUpdateEventKind = iota
+	// aptUpdateEventRepoFailed is an "Err:" line — a repository failed to fetch
+	aptUpdateEventRepoFailed
+	// aptUpdateEventKeyMissing is a NO_PUBKEY signature failure
+	aptUpdateEventKeyMissing
+)
+
+// aptUpdateEvent is one structured finding, recorded while the stream is
+// parsed so consumers never have to re-scan the text afterwards
+type aptUpdateEvent struct {
+	Kind aptUpdateEventKind
+	Line string // the ANSI-stripped line the finding came from
+	Key  string // missing signing key ID, set for aptUpdateEventKeyMissing
+}
+
+// aptUpdateStream classifies, filters and forwards apt update output one
+// line at a time. Noise lines are dropped with the same rules LessApt
+// applies, everything else is forwarded to out immediately, and the
+// filtered text is retained only for the failure diagnosis dump.
+type aptUpdateStream struct {
+	out  io.Writer
+	kept strings.Builder // filtered output, kept for the failure diagnosis dump
+
+	events         []aptUpdateEvent
+	failed         bool // an Err:/E: marker was seen anywhere in the output
+	autoremovable  bool
+	upgradableMany bool
+	upgradableOne  bool
+}
+
+// newAptUpdateStream returns a stream forwarding filtered output to out
+func newAptUpdateStream(out io.Writer) *aptUpdateStream {
+	return &aptUpdateStream{out: out}
+}
+
+// ProcessLine handles one line of combined apt stdout/stderr: strip ANSI
+// codes once, record structured findings, then either drop the line as
+// noise or forward it — a single pass with no post-processing left over
+// for after the command exits.
+func (s *aptUpdateStream) ProcessLine(line string) {
+	line = stripAnsiCodes(line)
+	if line == "" {
+		return
+	}
+
+	trimmed := strings.TrimSpace(line)
+	switch {
+	case strings.HasPrefix(trimmed, "Err:"):
+		s.events = append(s.events, aptUpdateEvent{Kind: aptUpdateEventRepoFailed, Line: line})
+	case strings.HasPrefix(trimmed, "E:"):
+		s.events = append(s.events, aptUpdateEvent{Kind: aptUpdateEventError, Line: line})
+	}
+	if idx := strings.Index(line, "NO_PUBKEY "); idx >= 0 {
+		key := line[idx+len("NO_PUBKEY "):]
+		if end := strings.IndexByte(key, ' '); end >= 0 {
+			key = key[:end]
+		}
+		s.events = append(s.events, aptUpdateEvent{Kind: aptUpdateEventKeyMissing, Line: line, Key: key})
+	}
+	if strings.Contains(line, "Err:") || strings.Contains(line, "E:") {
+		s.failed = true
+	}
+
+	// Advice printed after apt finishes, matching both APT 2.x and 3.0
+	// wording. Both upgrade flags may be set; the singular message is only
+	// used when no plural marker appeared.
+	if strings.Contains(line, "autoremove to remove them") ||
+		strings.Contains(line, "can be autoremoved") {
+		s.autoremovable = true
+	}
+	if strings.Contains(line, "packages can be upgraded") ||
+		strings.Contains(line, "can be upgraded") ||
+		strings.Contains(line, "upgradable") {
+		s.upgradableMany = true
+	}
+	if strings.Contains(line, "package can be upgraded") ||
+		strings.Contains(line, "is upgradable") {
+		s.upgradableOne = true
+	}
+
+	if aptNoiseLine(line) {
+		return
+	}
+	fmt.Fprintln(s.out, line)
+	s.kept.WriteString(line)
+	s.kept.WriteByte('\n')
+}
+
+// output returns the filtered output accumulated so far, for the full dump
+// printed when apt update fails
+func (s *aptUpdateStream) output() string {
+	return s.kept.String()
+}
+
+// errorLines returns the E:/Err: lines apt reported, in order
+func (s *aptUpdateStream) errorLines() []string {
+	var lines []string
+	for _, event := range s.events {
+		if event.Kind == aptUpdateEventError || event.Kind == aptUpdateEventRepoFailed {
+			lines = append(lines, event.Line)
+		}
+	}
+	return lines
+}
+
+// missingKeys returns the signing key IDs from NO_PUBKEY failures, in order
+func (s *aptUpdateStream) missingKeys() []string {
+	var keys []string
+	for _, event := range s.events {
+		if event.Kind == aptUpdateEventKeyMissing {
+			keys = append(keys, event.Key)
+		}
+	}
+	return keys
+}
@@ -0,0 +1,195 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: bench_test.go
+// Description: Benchmarks for the app listing, search and package status hot
+// paths, driven by a synthetic apps tree. Run them with `make bench`; the
+// tree sizes default to 100/500/2000 apps and can be overridden through the
+// PI_APPS_BENCH_SIZES environment variable (comma-separated counts). The
+// reported MB/s is the synthetic tree volume processed per iteration, so a
+// drop in it means the same data got more expensive to go through.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"fmt"
+	"io/fs"
+	"os"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"testing"
+)
+
+// benchTreeSizes returns the synthetic tree sizes to benchmark against
+func benchTreeSizes() []int {
+	if env := os.Getenv("PI_APPS_BENCH_SIZES"); env != "" {
+		var sizes []int
+		for _, field := range strings.Split(env, ",") {
+			if n, err := strconv.Atoi(strings.TrimSpace(field)); err == nil && n > 0 {
+				sizes = append(sizes, n)
+			}
+		}
+		if len(sizes) > 0 {
+			return sizes
+		}
+	}
+	return []int{100, 500, 2000}
+}
+
+// makeBenchTree builds a synthetic Pi-Apps directory with n apps: every app
+// has a description, website and icon, every tenth app is a package app, the
+// rest have install scripts, and half of them are marked installed
+func makeBenchTree(b testing.TB, n int) string {
+	b.Helper()
+	dir := b.TempDir()
+
+	for _, sub := range []string{
+		filepath.Join("apps"),
+		filepath.Join("update", "pi-apps", "apps"),
+		filepath.Join("data", "status"),
+		filepath.Join("data", "settings"),
+		filepath.Join("data", "categories"),
+	} {
+		if err := os.MkdirAll(filepath.Join(dir, sub), 0755); err != nil {
+			b.Fatal(err)
+		}
+	}
+
+	// Marker files checked by the Pi-Apps directory validation
+	for _, marker := range []string{"api", "gui"} {
+		if err := os.WriteFile(filepath.Join(dir, marker), []byte("#!/bin/sh\n"), 0755); err != nil {
+			b.Fatal(err)
+		}
+	}
+
+	var overrides strings.Builder
+	for i := 0; i < n; i++ {
+		app := fmt.Sprintf("Bench App %04d", i)
+		appDir := filepath.Join(dir, "apps", app)
+		if err := os.MkdirAll(appDir, 0755); err != nil {
+			b.Fatal(err)
+		}
+
+		description := fmt.Sprintf("Synthetic benchmark app number %04d with a realistic description line.\nA second line that listing code must skip.\n", i)
+		os.WriteFile(filepath.Join(appDir, "description"), []byte(description), 0644)
+		os.WriteFile(filepath.Join(appDir, "website"), []byte("https://example.com/bench\n"), 0644)
+		os.WriteFile(filepath.Join(appDir, "credits"), []byte("Written by the benchmark generator\n"), 0644)
+		os.WriteFile(filepath.Join(appDir, "icon-24.png"), make([]byte, 600), 0644)
+
+		if i%10 == 0 {
+			os.WriteFile(filepath.Join(appDir, "packages"), []byte("bash\n"), 0644)
+		} else {
+			os.WriteFile(filepath.Join(appDir, "install-64"), []byte("#!/bin/bash\ntrue\n"), 0755)
+			os.WriteFile(filepath.Join(appDir, "install-32"), []byte("#!/bin/bash\ntrue\n"), 0755)
+			os.WriteFile(filepath.Join(appDir, "uninstall"), []byte("#!/bin/bash\ntrue\n"), 0755)
+		}
+
+		switch i % 4 {
+		case 0, 1:
+			os.WriteFile(filepath.Join(dir, "data", "status", app), []byte("installed"), 0644)
+		case 2:
+			os.WriteFile(filepath.Join(dir, "data", "status", app), []byte("uninstalled"), 0644)
+		}
+
+		// Mirror the app in the online repository copy
+		os.MkdirAll(filepath.Join(dir, "update", "pi-apps", "apps", app), 0755)
+
+		overrides.WriteString(app + "|Tools\n")
+	}
+	if err := os.WriteFile(filepath.Join(dir, "data", "category-overrides"), []byte(overrides.String()), 0644); err != nil {
+		b.Fatal(err)
+	}
+
+	return dir
+}
+
+// benchTreeBytes sums the file sizes of the synthetic tree, so b.SetBytes
+// reports the data volume each iteration works through
+func benchTreeBytes(b testing.TB, dir string) int64 {
+	b.Helper()
+	var total int64
+	filepath.WalkDir(dir, func(path string, d fs.DirEntry, err error) error {
+		if err != nil || d.IsDir() {
+			return nil
+		}
+		if info, err := d.Info(); err == nil {
+			total += info.Size()
+		}
+		return nil
+	})
+	return total
+}
+
+func BenchmarkListApps(b *testing.B) {
+	for _, size := range benchTreeSizes() {
+		dir := makeBenchTree(b, size)
+		bytes := benchTreeBytes(b, dir)
+		for _, filter := range []string{"local", "all", "installed", "cpu_installable"} {
+			b.Run(fmt.Sprintf("%s-%d", filter, size), func(b *testing.B) {
+				b.Setenv("PI_APPS_DIR", dir)
+				b.ReportAllocs()
+				b.SetBytes(bytes)
+				for i := 0; i < b.N; i++ {
+					if _, err := ListApps(filter); err != nil {
+						b.Fatal(err)
+					}
+				}
+			})
+		}
+	}
+}
+
+func BenchmarkAppSearch(b *testing.B) {
+	for _, size := range benchTreeSizes() {
+		dir := makeBenchTree(b, size)
+		bytes := benchTreeBytes(b, dir)
+		b.Run(fmt.Sprintf("%d", size), func(b *testing.B) {
+			b.Setenv("PI_APPS_DIR", dir)
+			b.ReportAllocs()
+			b.SetBytes(bytes)
+			for i := 0; i < b.N; i++ {
+				if _, err := AppSearch("realistic"); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+func BenchmarkRefreshAllPkgAppStatus(b *testing.B) {
+	for _, size := range benchTreeSizes() {
+		dir := makeBenchTree(b, size)
+		bytes := benchTreeBytes(b, dir)
+		b.Run(fmt.Sprintf("%d", size), func(b *testing.B) {
+			b.Setenv("PI_APPS_DIR", dir)
+			// The refresh drives the real package manager; skip rather
+			// than fail on machines that don't have one
+			if err := RefreshAllPkgAppStatus(); err != nil {
+				b.Skipf("package manager unavailable: %v", err)
+			}
+			b.ReportAllocs()
+			b.SetBytes(bytes)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if err := RefreshAllPkgAppStatus(); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
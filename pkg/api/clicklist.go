@@ -0,0 +1,332 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: clicklist.go
+// Description: Clicklist cache subsystem backing UserCount. The downloaded
+// clicklist is parsed once into a sorted binary index persisted under
+// data/index/, refreshed with conditional GET (ETag/If-Modified-Since) so an
+// unchanged upstream file costs one header exchange, and refreshed in the
+// background once loaded so per-app lookups never block on the network.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"io"
+	"net/http"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+	"time"
+)
+
+// Index file layout (all integers little-endian):
+//
+//	[4]byte  magic "PACL"
+//	uint16   format version
+//	uint16   reserved
+//	int64    fetch time (unix seconds)
+//	string   ETag           (uint16 length + bytes)
+//	string   Last-Modified  (uint16 length + bytes)
+//	uint32   record count
+//	records, sorted by app name:
+//	  string app name  (uint16 length + bytes)
+//	  string count     (uint16 length + bytes, decimal digits)
+const (
+	clicklistMagic   = "PACL"
+	clicklistVersion = 1
+
+	clicklistURL    = "https://raw.githubusercontent.com/Botspot/pi-apps-analytics/main/clicklist"
+	clicklistMaxAge = 24 * time.Hour
+)
+
+// clicklistIndex is the decoded index plus the validators for the next
+// conditional fetch
+type clicklistIndex struct {
+	fetchedAt    time.Time
+	etag         string
+	lastModified string
+	counts       map[string]string // app name -> user count
+}
+
+// Cache the decoded index in-process so UserCount is a map lookup after the
+// first call. The refreshing flag keeps concurrent callers from stacking up
+// background downloads.
+var (
+	clicklistMu         sync.Mutex
+	clicklistCache      *clicklistIndex
+	clicklistRefreshing bool
+)
+
+// clicklistIndexPath returns the location of the packed clicklist index
+func clicklistIndexPath(directory string) string {
+	return filepath.Join(directory, "data", "index", "clicklist.bin")
+}
+
+// parseClicklist converts the raw "count app-name" lines into a lookup map
+func parseClicklist(content string) map[string]string {
+	counts := make(map[string]string)
+	scanner := bufio.NewScanner(strings.NewReader(content))
+	for scanner.Scan() {
+		line := scanner.Text()
+		space := strings.IndexByte(line, ' ')
+		if space <= 0 || space == len(line)-1 {
+			continue
+		}
+		counts[line[space+1:]] = line[:space]
+	}
+	return counts
+}
+
+// writeClicklistIndexFile persists the index, sorted by app name
+func writeClicklistIndexFile(path string, index *clicklistIndex) error {
+	if err := os.MkdirAll(filepath.Dir(path), 0755); err != nil {
+		return fmt.Errorf("failed to create index directory: %w", err)
+	}
+
+	apps := make([]string, 0, len(index.counts))
+	for app := range index.counts {
+		apps = append(apps, app)
+	}
+	sort.Strings(apps)
+
+	var buf bytes.Buffer
+	buf.WriteString(clicklistMagic)
+	binary.Write(&buf, binary.LittleEndian, uint16(clicklistVersion))
+	binary.Write(&buf, binary.LittleEndian, uint16(0))
+	binary.Write(&buf, binary.LittleEndian, index.fetchedAt.Unix())
+
+	writeString := func(s string) {
+		binary.Write(&buf, binary.LittleEndian, uint16(len(s)))
+		buf.WriteString(s)
+	}
+
+	writeString(index.etag)
+	writeString(index.lastModified)
+	binary.Write(&buf, binary.LittleEndian, uint32(len(apps)))
+	for _, app := range apps {
+		writeString(app)
+		writeString(index.counts[app])
+	}
+
+	// Write to a temporary file and rename for atomicity
+	tmpFile := path + "-tmp"
+	if err := os.WriteFile(tmpFile, buf.Bytes(), 0644); err != nil {
+		return fmt.Errorf("failed to write index file: %w", err)
+	}
+	return os.Rename(tmpFile, path)
+}
+
+// readClicklistIndexFile maps the index file into memory and decodes it
+func readClicklistIndexFile(path string) (*clicklistIndex, error) {
+	data, closer, err := mapIndexFile(path)
+	if err != nil {
+		return nil, err
+	}
+	defer closer()
+
+	if len(data) < 4+2+2+8 || string(data[:4]) != clicklistMagic {
+		return nil, fmt.Errorf("invalid index file: %s", path)
+	}
+
+	offset := 4
+	if version := binary.LittleEndian.Uint16(data[offset:]); version != clicklistVersion {
+		return nil, fmt.Errorf("unsupported index version: %d", version)
+	}
+	offset += 4 // version + reserved
+
+	fetchedAt := int64(binary.LittleEndian.Uint64(data[offset:]))
+	offset += 8
+
+	readString := func() (string, error) {
+		if offset+2 > len(data) {
+			return "", fmt.Errorf("truncated index file: %s", path)
+		}
+		length := int(binary.LittleEndian.Uint16(data[offset:]))
+		offset += 2
+		if offset+length > len(data) {
+			return "", fmt.Errorf("truncated index file: %s", path)
+		}
+		// Copy out of the mapping so the string stays valid after unmap
+		s := string(data[offset : offset+length])
+		offset += length
+		return s, nil
+	}
+
+	index := &clicklistIndex{fetchedAt: time.Unix(fetchedAt, 0)}
+	if index.etag, err = readString(); err != nil {
+		return nil, err
+	}
+	if index.lastModified, err = readString(); err != nil {
+		return nil, err
+	}
+
+	if offset+4 > len(data) {
+		return nil, fmt.Errorf("truncated index file: %s", path)
+	}
+	count := binary.LittleEndian.Uint32(data[offset:])
+	offset += 4
+
+	index.counts = make(map[string]string, count)
+	for i := uint32(0); i < count; i++ {
+		app, err := readString()
+		if err != nil {
+			return nil, err
+		}
+		userCount, err := readString()
+		if err != nil {
+			return nil, err
+		}
+		index.counts[app] = userCount
+	}
+
+	return index, nil
+}
+
+// fetchClicklist downloads the clicklist, sending the previous validators so
+// an unchanged upstream file answers 304 without a body. On success both the
+// raw data/clicklist file and the binary index are rewritten; on 304 only the
+// fetch time is bumped.
+func fetchClicklist(directory string, previous *clicklistIndex) (*clicklistIndex, error) {
+	request, err := http.NewRequest(http.MethodGet, clicklistURL, nil)
+	if err != nil {
+		return nil, fmt.Errorf("failed to build clicklist request: %w", err)
+	}
+	if previous != nil {
+		if previous.etag != "" {
+			request.Header.Set("If-None-Match", previous.etag)
+		}
+		if previous.lastModified != "" {
+			request.Header.Set("If-Modified-Since", previous.lastModified)
+		}
+	}
+
+	client := &http.Client{Timeout: 30 * time.Second}
+	resp, err := client.Do(request)
+	if err != nil {
+		return nil, fmt.Errorf("failed to download clicklist: %w", err)
+	}
+	defer resp.Body.Close()
+
+	if resp.StatusCode == http.StatusNotModified && previous != nil {
+		refreshed := &clicklistIndex{
+			fetchedAt:    time.Now(),
+			etag:         previous.etag,
+			lastModified: previous.lastModified,
+			counts:       previous.counts,
+		}
+		if err := writeClicklistIndexFile(clicklistIndexPath(directory), refreshed); err != nil {
+			DebugTf("Failed to persist clicklist index: %v", err)
+		}
+		return refreshed, nil
+	}
+	if resp.StatusCode != http.StatusOK {
+		return nil, fmt.Errorf("failed to download clicklist: status %d", resp.StatusCode)
+	}
+
+	body, err := io.ReadAll(resp.Body)
+	if err != nil {
+		return nil, fmt.Errorf("failed to download clicklist: %w", err)
+	}
+	if len(body) == 0 {
+		return nil, fmt.Errorf("usercount(): clicklist empty. Likely no internet connection")
+	}
+
+	// Keep the raw file in place for UserCount("") and external readers
+	dataDir := filepath.Join(directory, "data")
+	if err := os.MkdirAll(dataDir, 0755); err != nil {
+		return nil, fmt.Errorf("failed to create data directory: %w", err)
+	}
+	if err := os.WriteFile(filepath.Join(dataDir, "clicklist"), body, 0644); err != nil {
+		return nil, fmt.Errorf("failed to write clicklist file: %w", err)
+	}
+
+	index := &clicklistIndex{
+		fetchedAt:    time.Now(),
+		etag:         resp.Header.Get("ETag"),
+		lastModified: resp.Header.Get("Last-Modified"),
+		counts:       parseClicklist(string(body)),
+	}
+	if err := writeClicklistIndexFile(clicklistIndexPath(directory), index); err != nil {
+		DebugTf("Failed to persist clicklist index: %v", err)
+	}
+	return index, nil
+}
+
+// getClicklistIndex returns the current index, fetching synchronously only
+// when no usable data exists at all (first run). A stale index is returned
+// immediately while a background goroutine refreshes it, so callers on the
+// GUI thread never wait on the network once a cache exists.
+func getClicklistIndex(directory string) (*clicklistIndex, error) {
+	clicklistMu.Lock()
+	index := clicklistCache
+	if index == nil {
+		// Fall back to the persisted index from a previous run
+		if loaded, err := readClicklistIndexFile(clicklistIndexPath(directory)); err == nil {
+			index = loaded
+			clicklistCache = loaded
+		} else if raw, err := os.ReadFile(filepath.Join(directory, "data", "clicklist")); err == nil && len(raw) > 0 {
+			// A raw clicklist without an index (predating this cache):
+			// parse it once and index it for next time
+			if info, statErr := os.Stat(filepath.Join(directory, "data", "clicklist")); statErr == nil {
+				index = &clicklistIndex{fetchedAt: info.ModTime(), counts: parseClicklist(string(raw))}
+				clicklistCache = index
+				if err := writeClicklistIndexFile(clicklistIndexPath(directory), index); err != nil {
+					DebugTf("Failed to persist clicklist index: %v", err)
+				}
+			}
+		}
+	}
+
+	if index == nil {
+		// First run with no cache at all: the blocking download is unavoidable
+		clicklistMu.Unlock()
+		StatusT("Downloading latest clicklist data...")
+		fetched, err := fetchClicklist(directory, nil)
+		if err != nil {
+			return nil, err
+		}
+		clicklistMu.Lock()
+		clicklistCache = fetched
+		clicklistMu.Unlock()
+		return fetched, nil
+	}
+
+	// Stale cache: serve it now and refresh behind the scenes
+	if time.Since(index.fetchedAt) > clicklistMaxAge && !clicklistRefreshing {
+		clicklistRefreshing = true
+		go func(previous *clicklistIndex) {
+			fetched, err := fetchClicklist(directory, previous)
+			clicklistMu.Lock()
+			if err != nil {
+				DebugTf("Background clicklist refresh failed: %v", err)
+			} else {
+				clicklistCache = fetched
+			}
+			clicklistRefreshing = false
+			clicklistMu.Unlock()
+		}(index)
+	}
+	clicklistMu.Unlock()
+
+	return index, nil
+}
@@ -0,0 +1,304 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: device_facts.go
+// Description: Shared device-facts service. The hardware and OS probes used
+// by diagnostics (GetDeviceInfo), analytics and the error-report path are
+// executed once in parallel on first use, cached in memory for the session
+// and persisted under data/ keyed by the kernel boot ID, so batch log
+// formatting does not re-fork the same commands per file.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/json"
+	"fmt"
+	"net/http"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"sync"
+	"time"
+)
+
+// deviceFactsName is the boot-scoped cache file under data/
+const deviceFactsName = "device-facts"
+
+// deviceFacts holds every probe result that is stable for the duration of a
+// boot. Fields that can legitimately change while Pi-Apps runs (language
+// environment, update dates) are deliberately not part of this struct.
+type deviceFacts struct {
+	BootID          string  `json:"boot_id"`
+	Model           string  `json:"model"`
+	SocID           string  `json:"soc_id"`
+	MachineID       string  `json:"machine_id"`     // SHA1-hashed
+	SerialNumber    string  `json:"serial_number"`  // SHA1-hashed
+	OSName          string  `json:"os_name"`        // "ID VERSION_ID" form used by analytics
+	OSPrettyName    string  `json:"os_pretty_name"` // PRETTY_NAME form used by diagnostics
+	Arch            string  `json:"arch"`           // "32" or "64"
+	KernelArch      string  `json:"kernel_arch"`
+	KernelVersion   string  `json:"kernel_version"`
+	CPUName         string  `json:"cpu_name"`
+	RAMGB           float64 `json:"ram_gb"`
+	RPiImageVersion string  `json:"rpi_image_version"`
+}
+
+var (
+	deviceFactsOnce  sync.Once
+	deviceFactsValue deviceFacts
+)
+
+// getDeviceFacts returns the device facts, probing the system only when the
+// cache in data/ is missing or from a previous boot
+func getDeviceFacts() deviceFacts {
+	deviceFactsOnce.Do(func() {
+		bootID := currentBootID()
+		factsPath := filepath.Join(GetPiAppsDir(), "data", deviceFactsName)
+
+		// Reuse the cached facts if they are from this boot
+		if data, err := os.ReadFile(factsPath); err == nil {
+			var cached deviceFacts
+			if err := json.Unmarshal(data, &cached); err == nil && bootID != "" && cached.BootID == bootID {
+				deviceFactsValue = cached
+				return
+			}
+		}
+
+		deviceFactsValue = probeDeviceFacts(bootID)
+
+		if data, err := json.Marshal(deviceFactsValue); err == nil {
+			os.WriteFile(factsPath, data, 0644)
+		}
+	})
+	return deviceFactsValue
+}
+
+// probeDeviceFacts runs every probe concurrently; each one touches a
+// different file or command, so there is no ordering between them
+func probeDeviceFacts(bootID string) deviceFacts {
+	facts := deviceFacts{BootID: bootID}
+
+	var wg sync.WaitGroup
+	probe := func(fn func()) {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			fn()
+		}()
+	}
+
+	probe(func() { facts.Model, facts.SocID = GetDeviceModel() })
+	probe(func() { facts.MachineID = getHashedFileContent("/etc/machine-id") })
+	probe(func() { facts.SerialNumber = getHashedFileContent("/sys/firmware/devicetree/base/serial-number") })
+	probe(func() { facts.OSName = getOSName() })
+	probe(func() { facts.OSPrettyName = getOSPrettyName() })
+	probe(func() { facts.Arch = getArchitecture() })
+	probe(func() { facts.KernelArch = getKernelArch() })
+	probe(func() { facts.KernelVersion = getKernelVersion() })
+	probe(func() { facts.CPUName = getCPUName() })
+	probe(func() { facts.RAMGB = getRAMSizeGB() })
+	probe(func() { facts.RPiImageVersion = getRPiImageVersion() })
+	wg.Wait()
+
+	return facts
+}
+
+// currentBootID reads the kernel boot ID used to scope the facts cache
+func currentBootID() string {
+	data, err := os.ReadFile("/proc/sys/kernel/random/boot_id")
+	if err != nil {
+		return ""
+	}
+	return strings.TrimSpace(string(data))
+}
+
+// getOSPrettyName returns the PRETTY_NAME field from /etc/os-release
+func getOSPrettyName() string {
+	content, err := os.ReadFile("/etc/os-release")
+	if err != nil {
+		return ""
+	}
+
+	for _, line := range strings.Split(string(content), "\n") {
+		if strings.HasPrefix(line, "PRETTY_NAME=") {
+			return strings.Trim(strings.TrimPrefix(line, "PRETTY_NAME="), `"`)
+		}
+	}
+	return ""
+}
+
+// getKernelArch returns the machine hardware name (uname -m)
+func getKernelArch() string {
+	output, err := runCommand("uname", "-m")
+	if err != nil {
+		return ""
+	}
+	return strings.TrimSpace(output)
+}
+
+// getCPUName returns the CPU model name from /proc/cpuinfo
+func getCPUName() string {
+	cpuInfo, err := os.ReadFile("/proc/cpuinfo")
+	if err != nil {
+		return ""
+	}
+
+	scanner := bufio.NewScanner(bytes.NewReader(cpuInfo))
+	for scanner.Scan() {
+		line := scanner.Text()
+		if strings.HasPrefix(line, "model name") {
+			parts := strings.Split(line, ":")
+			if len(parts) > 1 {
+				return strings.TrimSpace(parts[1])
+			}
+		}
+	}
+	return ""
+}
+
+// getRAMSizeGB returns the total RAM size in gigabytes, 0 if unknown
+func getRAMSizeGB() float64 {
+	memInfo, err := os.ReadFile("/proc/meminfo")
+	if err != nil {
+		return 0
+	}
+
+	scanner := bufio.NewScanner(bytes.NewReader(memInfo))
+	for scanner.Scan() {
+		line := scanner.Text()
+		if strings.HasPrefix(line, "MemTotal") {
+			parts := strings.Fields(line)
+			if len(parts) > 1 {
+				memKB, _ := strconv.ParseFloat(parts[1], 64)
+				return memKB / 1024000.0
+			}
+		}
+	}
+	return 0
+}
+
+// getRPiImageVersion returns the Raspberry Pi OS image version from
+// /etc/rpi-issue, "" on other systems
+func getRPiImageVersion() string {
+	rpiIssue, err := os.ReadFile("/etc/rpi-issue")
+	if err != nil {
+		return ""
+	}
+
+	scanner := bufio.NewScanner(bytes.NewReader(rpiIssue))
+	for scanner.Scan() {
+		line := scanner.Text()
+		if strings.Contains(line, "Raspberry Pi reference") {
+			return strings.TrimSpace(strings.TrimPrefix(line, "Raspberry Pi reference "))
+		}
+	}
+	return ""
+}
+
+// Pi-Apps update dates are not boot-stable (an update can land mid-session),
+// but re-running `git show` and a GitHub API request for every log file a
+// batch formats is wasteful, so they are cached for the process lifetime.
+var (
+	piAppsDatesOnce  sync.Once
+	piAppsLocalDate  string
+	piAppsLatestDate string
+)
+
+// piAppsUpdateDates returns the formatted date of the last local update and
+// of the latest upstream commit ("" when unavailable)
+func piAppsUpdateDates() (local, latest string) {
+	piAppsDatesOnce.Do(func() {
+		piAppsDir := GetPiAppsDir()
+		if piAppsDir == "" || !fileExists(piAppsDir) {
+			return
+		}
+
+		// Last local update date from the git checkout
+		cmd := exec.Command("git", "-C", piAppsDir, "show", "-s", `--format=%ad`, "--date=short")
+		if output, err := cmd.Output(); err == nil {
+			commitDate := strings.TrimSpace(string(output))
+			if commitDate != "" {
+				// commitDate should be in format YYYY-MM-DD
+				if parsedTime, err := time.Parse("2006-01-02", commitDate); err == nil {
+					piAppsLocalDate = parsedTime.Format("01/02/2006")
+				} else {
+					piAppsLocalDate = commitDate
+				}
+			}
+		}
+
+		piAppsLatestDate = fetchLatestCommitDate(piAppsDir)
+	})
+	return piAppsLocalDate, piAppsLatestDate
+}
+
+// fetchLatestCommitDate asks the GitHub API for the date of the newest
+// upstream commit, using the repository recorded in etc/git_url
+func fetchLatestCommitDate(piAppsDir string) string {
+	gitURLPath := filepath.Join(piAppsDir, "etc", "git_url")
+	gitURLBytes, err := os.ReadFile(gitURLPath)
+	if err != nil {
+		return ""
+	}
+
+	// Parse account and repository from URL
+	parts := strings.Split(strings.TrimSpace(string(gitURLBytes)), "/")
+	if len(parts) < 2 {
+		return ""
+	}
+	account := parts[len(parts)-2]
+	repo := parts[len(parts)-1]
+
+	apiURL := fmt.Sprintf("https://api.github.com/repos/%s/%s/commits/master", account, repo)
+	req, err := http.NewRequest("GET", apiURL, nil)
+	if err != nil {
+		return ""
+	}
+
+	// Add GitHub API key if available
+	if apiKey := os.Getenv("GITHUB_API_KEY"); apiKey != "" {
+		req.Header.Set("Authorization", "token "+apiKey)
+	}
+
+	client := &http.Client{Timeout: 15 * time.Second}
+	resp, err := client.Do(req)
+	if err != nil {
+		return ""
+	}
+	defer resp.Body.Close()
+
+	var commits []struct {
+		Commit struct {
+			Author struct {
+				Date string `json:"date"`
+			} `json:"author"`
+		} `json:"commit"`
+	}
+	if err := json.NewDecoder(resp.Body).Decode(&commits); err != nil || len(commits) == 0 {
+		return ""
+	}
+
+	date, err := time.Parse(time.RFC3339, commits[0].Commit.Author.Date)
+	if err != nil {
+		return ""
+	}
+	return date.Format("01/02/2006")
+}
@@ -29,7 +29,6 @@ import (
 	"io"
 	"os"
 	"os/exec"
-	"regexp"
 	"sort"
 	"strings"
 	"time"
@@ -140,10 +139,7 @@ func LessApt(input string) string {
 // stripAnsiCodes removes ANSI color and formatting codes from a string
 // This is useful for processing the output of commands like apt that might include color codes
 func stripAnsiCodes(s string) string {
-	// ANSI escape sequences typically start with ESC (0x1B) followed by '[' and then some sequence
-	// This regex matches all ANSI escape sequences used for colors and formatting
-	re := regexp.MustCompile(`\x1b\[[0-9;]*[a-zA-Z]`)
-	return re.ReplaceAllString(s, "")
+	return stripAnsiString(s)
 }
 
 // fetchGPGKeyFromKeyserver retrieves a GPG key from a keyserver using HTTP
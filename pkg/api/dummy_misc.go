@@ -309,6 +309,12 @@ func installPackageAppDependencies(dependencies ...string) error {
 	return fmt.Errorf("failed to install dependencies: no package manager build tag is set")
 }
 
+// prefetchPackageAppDependencies pre-downloads the dependencies for a package-based app
+func prefetchPackageAppDependencies(dependencies ...string) error {
+	// return error if no package manager build tag is set
+	return fmt.Errorf("failed to download dependencies: no package manager build tag is set")
+}
+
 // uninstallPackageAppDependencies uninstalls the dependencies for a package-based app
 func uninstallPackageAppDependencies(dependencies ...string) error {
 	// return error if no package manager build tag is set
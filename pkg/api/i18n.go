@@ -25,6 +25,7 @@ import (
 	"os"
 	"path/filepath"
 	"strings"
+	"sync"
 
 	"github.com/leonelquinteros/gotext"
 )
@@ -38,8 +39,59 @@ var (
 	availableLocales []string
 	// Flag to track if i18n is initialized
 	i18nInitialized bool
+	// Memory-mapped precompiled catalog (preferred over gotext when present)
+	compiledCat *compiledCatalog
+	// Guards the lazy catalog open on the first T call
+	compiledCatOnce sync.Once
+	// Guards the lazy gotext load for plural lookups
+	pluralLocaleOnce sync.Once
 )
 
+// activeCatalog returns the precompiled catalog, opening it lazily on the
+// first translation call so binaries that never print a translated string
+// do not touch the catalog at all
+func activeCatalog() *compiledCatalog {
+	compiledCatOnce.Do(func() {
+		if compiledCat != nil || i18nInitialized {
+			return
+		}
+		translationsDir, err := getTranslationsDirectory()
+		if err != nil {
+			return
+		}
+		locale := detectLocale()
+		if catalog := openCompiledCatalog(translationsDir, locale); catalog != nil {
+			compiledCat = catalog
+			currentLocale = locale
+		} else if underscoreIndex := strings.Index(locale, "_"); underscoreIndex != -1 {
+			languageCode := locale[:underscoreIndex]
+			if catalog := openCompiledCatalog(translationsDir, languageCode); catalog != nil {
+				compiledCat = catalog
+				currentLocale = languageCode
+			}
+		}
+	})
+	return compiledCat
+}
+
+// pluralLocale returns the gotext locale used for plural lookups, loading
+// it on first use when startup went through the compiled catalog
+func pluralLocale() *gotext.Locale {
+	pluralLocaleOnce.Do(func() {
+		if apiLocale != nil || currentLocale == "" {
+			return
+		}
+		translationsDir, err := getTranslationsDirectory()
+		if err != nil {
+			return
+		}
+		locale := gotext.NewLocale(translationsDir, currentLocale)
+		locale.AddDomain("pi-apps")
+		apiLocale = locale
+	})
+	return apiLocale
+}
+
 // InitializeApiI18n initializes the internationalization system for the API package
 func InitializeApiI18n() error {
 	// Detect system locale
@@ -51,6 +103,25 @@ func InitializeApiI18n() error {
 		return fmt.Errorf("failed to find translations directory: %v", err)
 	}
 
+	// Prefer a precompiled catalog: it is memory-mapped instead of parsed,
+	// so startup skips loading the gettext data entirely (plural lookups
+	// load gotext lazily if they ever happen)
+	if catalog := openCompiledCatalog(translationsDir, locale); catalog != nil {
+		compiledCat = catalog
+	} else if underscoreIndex := strings.Index(locale, "_"); underscoreIndex != -1 {
+		languageCode := locale[:underscoreIndex]
+		if catalog := openCompiledCatalog(translationsDir, languageCode); catalog != nil {
+			compiledCat = catalog
+			locale = languageCode
+		}
+	}
+	if compiledCat != nil {
+		currentLocale = locale
+		availableLocales = scanAvailableLocales(translationsDir)
+		i18nInitialized = true
+		return setSystemLocale(locale)
+	}
+
 	// Initialize gotext locale
 	apiLocale = gotext.NewLocale(translationsDir, locale)
 	apiLocale.AddDomain("pi-apps")
@@ -82,6 +153,12 @@ func InitializeApiI18n() error {
 
 // T translates a string using the API locale
 func T(msgid string) string {
+	if catalog := activeCatalog(); catalog != nil {
+		if translated, ok := catalog.get(msgid); ok {
+			return translated
+		}
+		return msgid
+	}
 	if !i18nInitialized || apiLocale == nil {
 		return msgid
 	}
@@ -90,37 +167,23 @@ func T(msgid string) string {
 
 // Tf translates a formatted string using the API locale
 func Tf(format string, args ...interface{}) string {
-	if !i18nInitialized || apiLocale == nil {
-		return fmt.Sprintf(format, args...)
-	}
-	translated := apiLocale.Get(format)
-	return fmt.Sprintf(translated, args...)
+	return fmt.Sprintf(T(format), args...)
 }
 
 // Tn translates a string with plural support using the API locale
 func Tn(msgid, msgidPlural string, n int) string {
-	if !i18nInitialized || apiLocale == nil {
-		if n == 1 {
-			return msgid
-		}
-		return msgidPlural
+	if locale := pluralLocale(); locale != nil {
+		return locale.GetN(msgid, msgidPlural, n)
 	}
-	return apiLocale.GetN(msgid, msgidPlural, n)
+	if n == 1 {
+		return msgid
+	}
+	return msgidPlural
 }
 
 // Tnf translates a formatted string with plural support using the API locale
 func Tnf(msgid, msgidPlural string, n int, args ...interface{}) string {
-	if !i18nInitialized || apiLocale == nil {
-		var format string
-		if n == 1 {
-			format = msgid
-		} else {
-			format = msgidPlural
-		}
-		return fmt.Sprintf(format, args...)
-	}
-	translated := apiLocale.GetN(msgid, msgidPlural, n)
-	return fmt.Sprintf(translated, args...)
+	return fmt.Sprintf(Tn(msgid, msgidPlural, n), args...)
 }
 
 // SetApiLocale changes the current locale
@@ -134,6 +197,10 @@ func SetApiLocale(locale string) error {
 		return err
 	}
 
+	// Swap in the compiled catalog for the new locale (nil falls back to
+	// gotext below)
+	compiledCat = openCompiledCatalog(translationsDir, locale)
+
 	// Update the locale
 	apiLocale = gotext.NewLocale(translationsDir, locale)
 	apiLocale.AddDomain("pi-apps")
@@ -368,8 +435,9 @@ func scanAvailableLocales(translationsDir string) []string {
 	for _, entry := range entries {
 		if entry.IsDir() {
 			locale := entry.Name()
-			moFile := filepath.Join(translationsDir, locale, "LC_MESSAGES", "pi-apps.mo")
-			if apiFileExists(moFile) {
+			messagesDir := filepath.Join(translationsDir, locale, "LC_MESSAGES")
+			if apiFileExists(filepath.Join(messagesDir, "pi-apps.pamc")) ||
+				apiFileExists(filepath.Join(messagesDir, "pi-apps.mo")) {
 				locales = append(locales, locale)
 			}
 		}
@@ -0,0 +1,282 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: i18n_compiled.go
+// Description: Precompiled translation catalogs. xgotext flattens each
+// locale's .po file at build time into a hash-indexed binary catalog
+// (pi-apps.pamc) that is memory-mapped on first use, so binaries skip
+// parsing gettext data at startup and each T lookup is a binary search
+// over the mapped index with results interned after the first hit.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"bufio"
+	"encoding/binary"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+)
+
+// Compiled catalog file format (little endian):
+//
+//	[4]byte  magic "PAMC"
+//	uint16   version
+//	uint32   entry count
+//	entries: count * { hash uint64, keyOff, keyLen, valOff, valLen uint32 }
+//	         sorted by hash (ties broken by key bytes)
+//	blob:    concatenated msgid and msgstr bytes, offsets relative to
+//	         the blob start
+const (
+	catalogMagic   = "PAMC"
+	catalogVersion = 1
+
+	catalogHeaderSize = 4 + 2 + 4
+	catalogEntrySize  = 8 + 4*4
+)
+
+// compiledCatalog is an opened catalog backed by a memory-mapped file
+type compiledCatalog struct {
+	data  []byte // the whole mapped file
+	blob  []byte // string blob section
+	count int
+
+	mu     sync.RWMutex
+	intern map[string]string // msgid -> msgstr for already-looked-up entries
+}
+
+// catalogHash is 64-bit FNV-1a, matching what the writer stores
+func catalogHash(s string) uint64 {
+	hash := uint64(14695981039346656037)
+	for i := 0; i < len(s); i++ {
+		hash ^= uint64(s[i])
+		hash *= 1099511628211
+	}
+	return hash
+}
+
+// openCompiledCatalog maps the catalog for a locale, returning nil when no
+// compiled catalog exists
+func openCompiledCatalog(translationsDir, locale string) *compiledCatalog {
+	path := filepath.Join(translationsDir, locale, "LC_MESSAGES", "pi-apps.pamc")
+	data, _, err := mapIndexFile(path)
+	if err != nil {
+		return nil
+	}
+
+	if len(data) < catalogHeaderSize || string(data[:4]) != catalogMagic ||
+		binary.LittleEndian.Uint16(data[4:6]) != catalogVersion {
+		return nil
+	}
+
+	count := int(binary.LittleEndian.Uint32(data[6:catalogHeaderSize]))
+	blobStart := catalogHeaderSize + count*catalogEntrySize
+	if blobStart > len(data) {
+		return nil
+	}
+
+	return &compiledCatalog{
+		data:   data,
+		blob:   data[blobStart:],
+		count:  count,
+		intern: make(map[string]string),
+	}
+}
+
+// entry returns the fields of the i-th index entry
+func (c *compiledCatalog) entry(i int) (hash uint64, key, value []byte) {
+	offset := catalogHeaderSize + i*catalogEntrySize
+	hash = binary.LittleEndian.Uint64(c.data[offset:])
+	keyOff := binary.LittleEndian.Uint32(c.data[offset+8:])
+	keyLen := binary.LittleEndian.Uint32(c.data[offset+12:])
+	valOff := binary.LittleEndian.Uint32(c.data[offset+16:])
+	valLen := binary.LittleEndian.Uint32(c.data[offset+20:])
+	return hash, c.blob[keyOff : keyOff+keyLen], c.blob[valOff : valOff+valLen]
+}
+
+// get looks up a translation. Hot messages are interned on first lookup so
+// repeated calls return the cached string without touching the index.
+func (c *compiledCatalog) get(msgid string) (string, bool) {
+	c.mu.RLock()
+	if cached, ok := c.intern[msgid]; ok {
+		c.mu.RUnlock()
+		return cached, true
+	}
+	c.mu.RUnlock()
+
+	target := catalogHash(msgid)
+	i := sort.Search(c.count, func(i int) bool {
+		hash, _, _ := c.entry(i)
+		return hash >= target
+	})
+	for ; i < c.count; i++ {
+		hash, key, value := c.entry(i)
+		if hash != target {
+			break
+		}
+		if string(key) == msgid {
+			translated := string(value)
+			c.mu.Lock()
+			c.intern[msgid] = translated
+			c.mu.Unlock()
+			return translated, true
+		}
+	}
+	return "", false
+}
+
+// CompileMessageCatalog flattens a .po file into the binary catalog format
+// read by the API's translation functions. It is used by the xgotext tool
+// at build time.
+func CompileMessageCatalog(poPath, outPath string) error {
+	messages, err := parsePOFile(poPath)
+	if err != nil {
+		return err
+	}
+
+	type catalogEntry struct {
+		hash       uint64
+		key, value string
+	}
+	entries := make([]catalogEntry, 0, len(messages))
+	for msgid, msgstr := range messages {
+		if msgid == "" || msgstr == "" {
+			continue // header entry or untranslated message
+		}
+		entries = append(entries, catalogEntry{hash: catalogHash(msgid), key: msgid, value: msgstr})
+	}
+	sort.Slice(entries, func(i, j int) bool {
+		if entries[i].hash != entries[j].hash {
+			return entries[i].hash < entries[j].hash
+		}
+		return entries[i].key < entries[j].key
+	})
+
+	// Lay out the string blob
+	var blob strings.Builder
+	type layout struct{ keyOff, keyLen, valOff, valLen uint32 }
+	layouts := make([]layout, len(entries))
+	for i, entry := range entries {
+		layouts[i].keyOff = uint32(blob.Len())
+		layouts[i].keyLen = uint32(len(entry.key))
+		blob.WriteString(entry.key)
+		layouts[i].valOff = uint32(blob.Len())
+		layouts[i].valLen = uint32(len(entry.value))
+		blob.WriteString(entry.value)
+	}
+
+	tmpPath := outPath + ".tmp"
+	file, err := os.Create(tmpPath)
+	if err != nil {
+		return fmt.Errorf("failed to create catalog file: %w", err)
+	}
+
+	writer := bufio.NewWriter(file)
+	writer.WriteString(catalogMagic)
+	binary.Write(writer, binary.LittleEndian, uint16(catalogVersion))
+	binary.Write(writer, binary.LittleEndian, uint32(len(entries)))
+	for i, entry := range entries {
+		binary.Write(writer, binary.LittleEndian, entry.hash)
+		binary.Write(writer, binary.LittleEndian, layouts[i].keyOff)
+		binary.Write(writer, binary.LittleEndian, layouts[i].keyLen)
+		binary.Write(writer, binary.LittleEndian, layouts[i].valOff)
+		binary.Write(writer, binary.LittleEndian, layouts[i].valLen)
+	}
+	writer.WriteString(blob.String())
+
+	if err := writer.Flush(); err != nil {
+		file.Close()
+		os.Remove(tmpPath)
+		return fmt.Errorf("failed to write catalog file: %w", err)
+	}
+	if err := file.Close(); err != nil {
+		os.Remove(tmpPath)
+		return fmt.Errorf("failed to write catalog file: %w", err)
+	}
+	return os.Rename(tmpPath, outPath)
+}
+
+// parsePOFile reads the singular msgid/msgstr pairs from a .po file
+// (plural forms keep going through gotext, which already handles them)
+func parsePOFile(path string) (map[string]string, error) {
+	file, err := os.Open(path)
+	if err != nil {
+		return nil, err
+	}
+	defer file.Close()
+
+	messages := make(map[string]string)
+	var msgid, msgstr strings.Builder
+	var current *strings.Builder
+	haveMsgid := false
+
+	flush := func() {
+		if haveMsgid {
+			messages[msgid.String()] = msgstr.String()
+		}
+		msgid.Reset()
+		msgstr.Reset()
+		current = nil
+		haveMsgid = false
+	}
+
+	scanner := bufio.NewScanner(file)
+	scanner.Buffer(make([]byte, 64*1024), 1024*1024)
+	for scanner.Scan() {
+		line := strings.TrimSpace(scanner.Text())
+		switch {
+		case line == "" || strings.HasPrefix(line, "#"):
+			if line == "" {
+				flush()
+			}
+		case strings.HasPrefix(line, "msgid_plural "):
+			// Plural entries are left to gotext
+			current = nil
+		case strings.HasPrefix(line, "msgid "):
+			flush()
+			haveMsgid = true
+			current = &msgid
+			appendPOString(current, strings.TrimPrefix(line, "msgid "))
+		case strings.HasPrefix(line, "msgstr["):
+			current = nil
+		case strings.HasPrefix(line, "msgstr "):
+			current = &msgstr
+			appendPOString(current, strings.TrimPrefix(line, "msgstr "))
+		case strings.HasPrefix(line, `"`):
+			if current != nil {
+				appendPOString(current, line)
+			}
+		}
+	}
+	flush()
+
+	if err := scanner.Err(); err != nil {
+		return nil, err
+	}
+	return messages, nil
+}
+
+// appendPOString unquotes one .po string literal and appends it
+func appendPOString(builder *strings.Builder, quoted string) {
+	if unquoted, err := strconv.Unquote(quoted); err == nil {
+		builder.WriteString(unquoted)
+	}
+}
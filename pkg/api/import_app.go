@@ -28,7 +28,11 @@ import (
 	"net/http"
 	"os"
 	"path/filepath"
+	"runtime"
+	"sort"
 	"strings"
+	"sync"
+	"sync/atomic"
 
 	"github.com/gotk3/gotk3/gdk"
 	"github.com/gotk3/gotk3/glib"
@@ -406,40 +410,9 @@ func importFromLocalZip(zipPath, piAppsDir string) (string, error) {
 	}
 	defer os.RemoveAll(tmpDir)
 
-	// Extract zip contents
-	for _, file := range reader.File {
-		// Normalize and validate the file path
-		cleanPath := filepath.Join(tmpDir, filepath.Clean(file.Name))
-		if !strings.HasPrefix(cleanPath, tmpDir) {
-			return "", fmt.Errorf("invalid file path in zip: %s", file.Name)
-		}
-
-		if file.FileInfo().IsDir() {
-			os.MkdirAll(cleanPath, 0755)
-			continue
-		}
-
-		// Create parent directories
-		os.MkdirAll(filepath.Dir(cleanPath), 0755)
-
-		// Extract file
-		rc, err := file.Open()
-		if err != nil {
-			return "", fmt.Errorf("error opening zip file entry: %w", err)
-		}
-
-		out, err := os.Create(cleanPath)
-		if err != nil {
-			rc.Close()
-			return "", fmt.Errorf("error creating output file: %w", err)
-		}
-
-		_, err = io.Copy(out, rc)
-		out.Close()
-		rc.Close()
-		if err != nil {
-			return "", fmt.Errorf("error extracting file: %w", err)
-		}
+	// Extract zip contents with a worker pool
+	if err := extractZipFiles(reader.File, tmpDir, nil); err != nil {
+		return "", err
 	}
 
 	// Determine app name and validate structure
@@ -617,98 +590,61 @@ func importFromPRZip(zipURL, piAppsDir, branchName string) ([]string, error) {
 	}
 	defer os.RemoveAll(tmpDir)
 
-	// Extract zip contents
-	for _, file := range reader.File {
-		// Construct the path and resolve its absolute form
-		path := filepath.Join(tmpDir, file.Name)
-		absPath, err := filepath.Abs(path)
-		if err != nil {
-			return nil, fmt.Errorf("error resolving absolute path: %w", err)
+	// The archive root is the repository directory GitHub wraps everything
+	// in ("<repo>-<sha>/"); app entries look like "<root>/apps/<name>/...".
+	// Count the file entries per app up front so each app directory can be
+	// validated and imported as soon as its last entry is written, instead
+	// of waiting for the whole archive.
+	var repoRoot string
+	appOfEntry := func(name string) string {
+		parts := strings.Split(strings.Trim(name, "/"), "/")
+		if len(parts) >= 4 && parts[1] == "apps" {
+			return parts[2]
 		}
-
-		// Validate that the resolved path is within the intended directory
-		if !strings.HasPrefix(absPath, tmpDir) {
-			return nil, fmt.Errorf("invalid file path in zip: %s", file.Name)
+		return ""
+	}
+	pending := make(map[string]*atomic.Int32)
+	for _, file := range reader.File {
+		parts := strings.Split(strings.Trim(file.Name, "/"), "/")
+		if repoRoot == "" && len(parts) > 0 && parts[0] != "" {
+			repoRoot = parts[0]
 		}
-
 		if file.FileInfo().IsDir() {
-			os.MkdirAll(absPath, 0755)
 			continue
 		}
-
-		os.MkdirAll(filepath.Dir(absPath), 0755)
-
-		rc, err := file.Open()
-		if err != nil {
-			return nil, fmt.Errorf("error opening zip entry: %w", err)
-		}
-
-		out, err := os.Create(absPath)
-		if err != nil {
-			rc.Close()
-			return nil, fmt.Errorf("error creating output file: %w", err)
-		}
-
-		_, err = io.Copy(out, rc)
-		out.Close()
-		rc.Close()
-		if err != nil {
-			return nil, fmt.Errorf("error extracting file: %w", err)
-		}
-	}
-
-	// Find the extracted repository directory
-	entries, err := os.ReadDir(tmpDir)
-	if err != nil {
-		return nil, fmt.Errorf("error reading temporary directory: %w", err)
-	}
-
-	var repoDir string
-	for _, entry := range entries {
-		if entry.IsDir() {
-			repoDir = filepath.Join(tmpDir, entry.Name())
-			break
+		if app := appOfEntry(file.Name); app != "" {
+			if pending[app] == nil {
+				pending[app] = new(atomic.Int32)
+			}
+			pending[app].Add(1)
 		}
 	}
 
-	if repoDir == "" {
+	if repoRoot == "" {
 		return nil, fmt.Errorf("could not find repository directory in PR zip")
 	}
-
-	// Look for apps in the apps directory
-	appsDir := filepath.Join(repoDir, "apps")
-	if !isDir(appsDir) {
+	if len(pending) == 0 {
 		return nil, fmt.Errorf("no apps directory found in PR")
 	}
 
-	// Get list of apps from PR
-	prApps, err := os.ReadDir(appsDir)
-	if err != nil {
-		return nil, fmt.Errorf("error reading PR apps directory: %w", err)
-	}
-
-	// Get list of existing apps
-	existingAppsDir := filepath.Join(piAppsDir, "apps")
-	existingApps := make(map[string]bool)
-	if isDir(existingAppsDir) {
-		existing, err := os.ReadDir(existingAppsDir)
-		if err == nil {
-			for _, app := range existing {
-				if app.IsDir() {
-					existingApps[app.Name()] = true
-				}
+	// Extract in the background; completed app directories arrive on the
+	// channel while later entries are still being written
+	completed := make(chan string, len(pending))
+	extractErr := make(chan error, 1)
+	go func() {
+		extractErr <- extractZipFiles(reader.File, tmpDir, func(name string) {
+			if app := appOfEntry(name); app != "" && pending[app].Add(-1) == 0 {
+				completed <- app
 			}
-		}
-	}
+		})
+		close(completed)
+	}()
 
-	// Import new apps
-	var importedApps []string
-	for _, app := range prApps {
-		if !app.IsDir() {
-			continue
-		}
+	appsDir := filepath.Join(tmpDir, repoRoot, "apps")
 
-		appName := app.Name()
+	// Import apps as their directories complete
+	var importedApps []string
+	for appName := range completed {
 		appSourceDir := filepath.Join(appsDir, appName)
 
 		// Validate app structure
@@ -718,12 +654,6 @@ func importFromPRZip(zipURL, piAppsDir, branchName string) ([]string, error) {
 
 		// TODO: Add more sophisticated comparison for existing apps
 		// For now, we'll import all apps (both new and updates)
-		// In the future, we could add more sophisticated comparison that looks like this:
-		// Check if it's a new app or significantly different
-		// isNew := !existingApps[appName]
-		// if !isNew {
-		//	insert code here to check if the app is significantly different
-		// }
 
 		// Copy app to pi-apps directory
 		targetDir := filepath.Join(piAppsDir, "apps", appName)
@@ -736,15 +666,114 @@ func importFromPRZip(zipURL, piAppsDir, branchName string) ([]string, error) {
 		importedApps = append(importedApps, appName)
 	}
 
+	if err := <-extractErr; err != nil {
+		return nil, err
+	}
+
 	if len(importedApps) == 0 {
 		return nil, fmt.Errorf("no valid apps found in PR")
 	}
 
+	sort.Strings(importedApps)
 	return importedApps, nil
 }
 
-// copyDir recursively copies a directory
+// extractZipFiles writes the archive entries under destDir using a small
+// worker pool. Directories are created up front so workers never race on
+// MkdirAll; onEntry, when non-nil, is called from worker goroutines after
+// each file entry has been fully written.
+func extractZipFiles(files []*zip.File, destDir string, onEntry func(name string)) error {
+	// Normalize and validate every path before any worker touches the disk
+	paths := make([]string, len(files))
+	for i, file := range files {
+		cleanPath := filepath.Join(destDir, filepath.Clean(file.Name))
+		if !strings.HasPrefix(cleanPath, destDir) {
+			return fmt.Errorf("invalid file path in zip: %s", file.Name)
+		}
+		paths[i] = cleanPath
+		if file.FileInfo().IsDir() {
+			os.MkdirAll(cleanPath, 0755)
+		} else {
+			os.MkdirAll(filepath.Dir(cleanPath), 0755)
+		}
+	}
+
+	workers := runtime.GOMAXPROCS(0)
+	if workers > 4 {
+		workers = 4 // extraction is disk-bound; more workers just thrash
+	}
+
+	var (
+		errMu    sync.Mutex
+		firstErr error
+	)
+	fail := func(err error) {
+		errMu.Lock()
+		if firstErr == nil {
+			firstErr = err
+		}
+		errMu.Unlock()
+	}
+
+	var wg sync.WaitGroup
+	jobs := make(chan int)
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for i := range jobs {
+				file := files[i]
+				if file.FileInfo().IsDir() {
+					continue
+				}
+
+				rc, err := file.Open()
+				if err != nil {
+					fail(fmt.Errorf("error opening zip file entry: %w", err))
+					continue
+				}
+
+				out, err := os.Create(paths[i])
+				if err != nil {
+					rc.Close()
+					fail(fmt.Errorf("error creating output file: %w", err))
+					continue
+				}
+
+				_, err = io.Copy(out, rc)
+				out.Close()
+				rc.Close()
+				if err != nil {
+					fail(fmt.Errorf("error extracting file: %w", err))
+					continue
+				}
+
+				if onEntry != nil {
+					onEntry(file.Name)
+				}
+			}
+		}()
+	}
+	for i := range files {
+		jobs <- i
+	}
+	close(jobs)
+	wg.Wait()
+
+	return firstErr
+}
+
+// copyDir moves a directory into place. When src and dst are on the same
+// filesystem the whole tree is renamed in one syscall (consuming src, which
+// is always a temporary extraction directory here); otherwise it falls back
+// to a recursive file-by-file copy.
 func copyDir(src, dst string) error {
+	if err := os.MkdirAll(filepath.Dir(dst), 0755); err == nil {
+		if os.Rename(src, dst) == nil {
+			return nil
+		}
+	}
+
 	return filepath.Walk(src, func(path string, info os.FileInfo, err error) error {
 		if err != nil {
 			return err
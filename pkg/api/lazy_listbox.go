@@ -0,0 +1,84 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: lazy_listbox.go
+// Description: Incremental population helper for GtkListBox. GTK3 has no
+// factory-model list view, so large lists are windowed instead: the first
+// screenful of rows is built synchronously and the remainder is appended in
+// idle-callback batches between frames. Opening a view therefore costs the
+// visible rows, not the whole list, and the main loop keeps running while
+// the tail fills in.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"github.com/gotk3/gotk3/glib"
+	"github.com/gotk3/gotk3/gtk"
+)
+
+const (
+	// lazyListInitialRows are built synchronously before the view is shown —
+	// comfortably more than fit on screen at the default window size
+	lazyListInitialRows = 30
+
+	// lazyListBatchRows is how many rows each idle callback appends
+	lazyListBatchRows = 60
+)
+
+// ListBoxPopulateLazily fills listBox with total rows produced by createRow.
+// Rows for which createRow fails are skipped, matching the populate loops
+// this replaces. cancelled may be nil; when it is provided and reports true,
+// pending batches stop — use it so a view that was replaced mid-fill does
+// not keep appending rows to a destroyed list.
+func ListBoxPopulateLazily(listBox *gtk.ListBox, total int, cancelled func() bool, createRow func(index int) (*gtk.ListBoxRow, error)) {
+	add := func(index int) {
+		row, err := createRow(index)
+		if err != nil || row == nil {
+			return
+		}
+		listBox.Add(row)
+		// Rows appended after the container's ShowAll must be shown
+		// themselves or they stay invisible
+		row.ShowAll()
+	}
+
+	initial := total
+	if initial > lazyListInitialRows {
+		initial = lazyListInitialRows
+	}
+	for index := 0; index < initial; index++ {
+		add(index)
+	}
+	if initial == total {
+		return
+	}
+
+	next := initial
+	glib.IdleAdd(func() bool {
+		if cancelled != nil && cancelled() {
+			return false
+		}
+		end := next + lazyListBatchRows
+		if end > total {
+			end = total
+		}
+		for ; next < end; next++ {
+			add(next)
+		}
+		return next < total
+	})
+}
@@ -30,6 +30,7 @@ import (
 	"slices"
 	"sort"
 	"strings"
+	"sync"
 )
 
 // ListApps lists apps based on the specified filter
@@ -320,6 +321,12 @@ func ListUnion(list1, list2 []string) []string {
 
 // listLocalApps lists all locally available apps
 func listLocalApps(directory string) ([]string, error) {
+	// Resolve against the packed app index when available (one mmap plus an
+	// in-memory scan instead of statting every app directory)
+	if index, err := loadAppIndex(directory); err == nil {
+		return index.localApps(), nil
+	}
+
 	appsDir := filepath.Join(directory, "apps")
 
 	var apps []string
@@ -400,6 +407,13 @@ func listOnlineApps(directory string) ([]string, error) {
 
 // getAppsWithStatus returns a list of apps with the specified status (installed or uninstalled)
 func getAppsWithStatus(directory string, wantInstalled bool) ([]string, error) {
+	// Resolve against the packed app index when available
+	if index, err := loadAppIndex(directory); err == nil {
+		apps := index.appsWithStatus(wantInstalled)
+		sort.Strings(apps)
+		return apps, nil
+	}
+
 	// Get all local apps
 	allApps, err := listLocalApps(directory)
 	if err != nil {
@@ -439,14 +453,18 @@ func getAppsWithStatus(directory string, wantInstalled bool) ([]string, error) {
 		}
 	}
 
+	// Check each app's status concurrently - the per-app stat calls are
+	// independent, so overlapping them hides the I/O latency
+	var mu sync.Mutex
 	var filteredApps []string
-	for _, app := range allApps {
-		// Check if the app has the expected status
+	forEachApp(allApps, func(app string) {
 		isInstalled := checkAppInstalled(directory, app)
 		if (wantInstalled && isInstalled) || (!wantInstalled && !isInstalled) {
+			mu.Lock()
 			filteredApps = append(filteredApps, app)
+			mu.Unlock()
 		}
-	}
+	})
 
 	sort.Strings(filteredApps)
 	return filteredApps, nil
@@ -454,6 +472,13 @@ func getAppsWithStatus(directory string, wantInstalled bool) ([]string, error) {
 
 // getAppsWithStatusContent returns a list of apps with the specified status content
 func getAppsWithStatusContent(directory string, statusContent string) ([]string, error) {
+	// Resolve against the packed app index when available
+	if index, err := loadAppIndex(directory); err == nil {
+		apps := index.appsWithStatusContent(statusContent)
+		sort.Strings(apps)
+		return apps, nil
+	}
+
 	statusDir := filepath.Join(directory, "data", "status")
 	if _, err := os.Stat(statusDir); os.IsNotExist(err) {
 		// If status directory doesn't exist, create it
@@ -502,6 +527,13 @@ func getAppsWithStatusContent(directory string, statusContent string) ([]string,
 
 // getCorruptedApps returns a list of corrupted apps
 func getCorruptedApps(directory string) ([]string, error) {
+	// Resolve against the packed app index when available
+	if index, err := loadAppIndex(directory); err == nil {
+		apps := index.corruptedApps()
+		sort.Strings(apps)
+		return apps, nil
+	}
+
 	// Get all local apps
 	allApps, err := listLocalApps(directory)
 	if err != nil {
@@ -543,6 +575,13 @@ func getCorruptedApps(directory string) ([]string, error) {
 
 // getAppsWithStatusFiles returns a list of apps that have status files
 func getAppsWithStatusFiles(directory string) ([]string, error) {
+	// Resolve against the packed app index when available
+	if index, err := loadAppIndex(directory); err == nil {
+		apps := index.appsWithStatusFiles()
+		sort.Strings(apps)
+		return apps, nil
+	}
+
 	statusDir := filepath.Join(directory, "data", "status")
 	if _, err := os.Stat(statusDir); os.IsNotExist(err) {
 		// If status directory doesn't exist, create it
@@ -613,27 +652,25 @@ func getCPUInstallableApps(directory string) ([]string, error) {
 	// Get system architecture using multiple methods for better compatibility
 	arch := getSystemArchitecture()
 
+	// Resolve against the packed app index when available
+	if index, err := loadAppIndex(directory); err == nil {
+		apps := index.cpuInstallableApps(arch)
+		sort.Strings(apps)
+		return apps, nil
+	}
+
+	var mu sync.Mutex
 	var appNames []string
 	appPath := filepath.Join(directory, "apps")
 
-	// Find apps with install script, install-XX script, or packages file
-	err := filepath.WalkDir(appPath, func(path string, d fs.DirEntry, err error) error {
-		if err != nil {
-			// Skip permission denied errors for problematic directories
-			if os.IsPermission(err) {
-				return nil
+	// Find apps with install script, install-XX script, or packages file.
+	// Each app directory is examined by the shared concurrent scanner.
+	err := scanAppDirs(appPath, func(appName, appDir string, files []fs.DirEntry) {
+		for _, file := range files {
+			if file.IsDir() {
+				continue
 			}
-			return err
-		}
-
-		// Skip problematic directories entirely
-		if shouldSkipDirectory(path, d) {
-			return fs.SkipDir
-		}
-
-		if !d.IsDir() {
-			fileName := d.Name()
-			appName := filepath.Base(filepath.Dir(path))
+			fileName := file.Name()
 
 			// Check for different types of install possibilities:
 			// 1. Generic install script (works on all architectures)
@@ -643,10 +680,9 @@ func getCPUInstallableApps(directory string) ([]string, error) {
 			if fileName == "install" || fileName == "packages" || fileName == "flatpak_packages" {
 				// For flatpak packages, also check architecture compatibility
 				if fileName == "flatpak_packages" {
-					flatpakPackageContent, err := os.ReadFile(path)
+					flatpakPackageContent, err := os.ReadFile(filepath.Join(appDir, fileName))
 					if err != nil {
-						// logger.Warn(fmt.Sprintf("Failed to read flatpak_packages file for %s: %v", appName, err))
-						return nil // Skip this app if we can't read the file
+						continue // Skip this app if we can't read the file
 					}
 					flatpakIDs := strings.Fields(string(flatpakPackageContent))
 					allCompatible := true
@@ -657,21 +693,25 @@ func getCPUInstallableApps(directory string) ([]string, error) {
 						}
 					}
 					if allCompatible {
+						mu.Lock()
 						appNames = append(appNames, appName)
+						mu.Unlock()
 					}
 				} else {
+					mu.Lock()
 					appNames = append(appNames, appName)
+					mu.Unlock()
 				}
 			} else if isArchitectureSpecificInstallScript(fileName, arch) {
+				mu.Lock()
 				appNames = append(appNames, appName)
+				mu.Unlock()
 			}
 		}
-
-		return nil
 	})
 
 	if err != nil {
-		return nil, fmt.Errorf("failed to walk app directory: %w", err)
+		return nil, fmt.Errorf("failed to scan app directory: %w", err)
 	}
 
 	// Remove duplicates
@@ -728,34 +768,30 @@ func isArchitectureSpecificInstallScript(fileName, currentArch string) bool {
 
 // getAppsWithFile returns a list of apps that have the specified file
 func getAppsWithFile(directory string, fileName string) ([]string, error) {
-	var appNames []string
-	appPath := filepath.Join(directory, "apps")
-
-	err := filepath.WalkDir(appPath, func(path string, d fs.DirEntry, err error) error {
-		if err != nil {
-			// Skip permission denied errors for problematic directories
-			if os.IsPermission(err) {
-				return nil
-			}
-			return err
+	// The "packages" lookup is the common case and is covered by the packed
+	// app index; other file names fall through to the filesystem walk
+	if fileName == "packages" {
+		if index, err := loadAppIndex(directory); err == nil {
+			apps := index.appsWithPackagesFile()
+			sort.Strings(apps)
+			return apps, nil
 		}
+	}
 
-		// Skip problematic directories entirely
-		if shouldSkipDirectory(path, d) {
-			return fs.SkipDir
-		}
+	var mu sync.Mutex
+	var appNames []string
+	appPath := filepath.Join(directory, "apps")
 
-		if !d.IsDir() && d.Name() == fileName {
-			// Get app name (parent directory name)
-			appName := filepath.Base(filepath.Dir(path))
+	err := scanAppDirs(appPath, func(appName, appDir string, files []fs.DirEntry) {
+		if dirEntriesContain(files, fileName) {
+			mu.Lock()
 			appNames = append(appNames, appName)
+			mu.Unlock()
 		}
-
-		return nil
 	})
 
 	if err != nil {
-		return nil, fmt.Errorf("failed to walk app directory: %w", err)
+		return nil, fmt.Errorf("failed to scan app directory: %w", err)
 	}
 
 	sort.Strings(appNames)
@@ -764,51 +800,38 @@ func getAppsWithFile(directory string, fileName string) ([]string, error) {
 
 // getStandardApps returns a list of apps that have scripts
 func getStandardApps(directory string) ([]string, error) {
+	// Resolve against the packed app index when available
+	if index, err := loadAppIndex(directory); err == nil {
+		apps := index.standardApps()
+		sort.Strings(apps)
+		return apps, nil
+	}
+
+	var mu sync.Mutex
 	var appNames []string
 	appPath := filepath.Join(directory, "apps")
 
-	err := filepath.WalkDir(appPath, func(path string, d fs.DirEntry, err error) error {
-		if err != nil {
-			// Skip permission denied errors for problematic directories
-			if os.IsPermission(err) {
-				return nil
+	err := scanAppDirs(appPath, func(appName, appDir string, files []fs.DirEntry) {
+		for _, file := range files {
+			if file.IsDir() {
+				continue
 			}
-			return err
-		}
-
-		// Skip problematic directories entirely
-		if shouldSkipDirectory(path, d) {
-			return fs.SkipDir
-		}
-
-		if !d.IsDir() {
-			fileName := d.Name()
+			fileName := file.Name()
 			if fileName == "install" || fileName == "install-32" || fileName == "install-64" || fileName == "uninstall" {
-				// Get app name (parent directory name)
-				appName := filepath.Base(filepath.Dir(path))
+				mu.Lock()
 				appNames = append(appNames, appName)
+				mu.Unlock()
+				return
 			}
 		}
-
-		return nil
 	})
 
 	if err != nil {
-		return nil, fmt.Errorf("failed to walk app directory: %w", err)
+		return nil, fmt.Errorf("failed to scan app directory: %w", err)
 	}
 
-	// Remove duplicates
-	uniqueApps := make(map[string]bool)
-	var result []string
-	for _, app := range appNames {
-		if !uniqueApps[app] {
-			uniqueApps[app] = true
-			result = append(result, app)
-		}
-	}
-
-	sort.Strings(result)
-	return result, nil
+	sort.Strings(appNames)
+	return appNames, nil
 }
 
 // getCategoryApps returns a list of apps in the specified category
@@ -0,0 +1,658 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: list_index.go
+// Description: Provides a packed, memory-mappable index of app metadata so that
+// ListApps filters resolve against a single file instead of re-reading hundreds
+// of tiny files (status, categories, install scripts) on every invocation.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+)
+
+// Index file layout (all integers little-endian):
+//
+//	[4]byte  magic "PAIX"
+//	uint16   format version
+//	uint16   reserved
+//	int64    apps directory fingerprint
+//	int64    status directory fingerprint
+//	int64    categories fingerprint (categories dir + category-overrides file)
+//	uint32   record count
+//	records:
+//	  int64  app directory mtime (unix seconds)
+//	  uint16 flags (see appIndexFlag* below)
+//	  string name            (uint16 length + bytes)
+//	  string status content  (uint16 length + bytes, empty if no status file)
+//	  string category        (uint16 length + bytes)
+//	  string flatpak IDs     (uint16 length + bytes, space-separated)
+const (
+	appIndexMagic   = "PAIX"
+	appIndexVersion = 1
+)
+
+// Per-record flags describing which files exist in the app directory
+const (
+	appIndexFlagInstall = 1 << iota
+	appIndexFlagInstall32
+	appIndexFlagInstall64
+	appIndexFlagUninstall
+	appIndexFlagPackages
+	appIndexFlagFlatpakPackages
+	appIndexFlagIcon
+	appIndexFlagDescription
+	appIndexFlagStatusFile
+	appIndexFlagDeprecated
+)
+
+// appIndexEntry is the in-memory form of one index record
+type appIndexEntry struct {
+	Name       string
+	Status     string // trimmed status file content, "" if no status file
+	Category   string
+	FlatpakIDs string // space-separated flatpak app IDs from flatpak_packages
+	DirMTime   int64
+	Flags      uint16
+}
+
+// appIndex holds the decoded index plus lookup structures
+type appIndex struct {
+	entries []appIndexEntry
+	byName  map[string]*appIndexEntry
+}
+
+// Cache the decoded index per directory so repeated ListApps calls within one
+// process don't re-read the file. The fingerprints are revalidated on each
+// load, so a stale in-process copy is refreshed as soon as the tree changes.
+var (
+	appIndexMu     sync.Mutex
+	appIndexCache  = make(map[string]*appIndex)
+	appIndexFprint = make(map[string][3]int64)
+)
+
+// appIndexPath returns the location of the packed index file
+func appIndexPath(directory string) string {
+	return filepath.Join(directory, "data", "index", "apps.bin")
+}
+
+// dirFingerprint produces a cheap fingerprint of a single directory level:
+// the sum of entry mtimes plus the entry count. It changes whenever a file
+// in the directory is created, removed, or rewritten, without walking any
+// subdirectories.
+func dirFingerprint(path string) int64 {
+	entries, err := os.ReadDir(path)
+	if err != nil {
+		return 0
+	}
+
+	var fingerprint int64
+	for _, entry := range entries {
+		info, err := entry.Info()
+		if err != nil {
+			continue
+		}
+		fingerprint += info.ModTime().Unix()
+	}
+	return fingerprint + int64(len(entries))
+}
+
+// appIndexFingerprints returns the current fingerprints of the three sources
+// the index is built from: the apps tree, the status directory, and the
+// category assignments.
+func appIndexFingerprints(directory string) [3]int64 {
+	categoriesFprint := dirFingerprint(filepath.Join(directory, "data", "categories"))
+	if stat, err := os.Stat(filepath.Join(directory, "data", "category-overrides")); err == nil {
+		categoriesFprint += stat.ModTime().Unix()
+	}
+
+	return [3]int64{
+		dirFingerprint(filepath.Join(directory, "apps")),
+		dirFingerprint(filepath.Join(directory, "data", "status")),
+		categoriesFprint,
+	}
+}
+
+// loadAppIndex returns an up-to-date index for the given Pi-Apps directory.
+// It serves from the in-process cache when the fingerprints still match,
+// otherwise maps the on-disk index, and rebuilds it (reusing unchanged
+// records) when the apps tree has changed since the index was written.
+func loadAppIndex(directory string) (*appIndex, error) {
+	appIndexMu.Lock()
+	defer appIndexMu.Unlock()
+
+	current := appIndexFingerprints(directory)
+
+	// Fast path: the in-process copy is still valid
+	if cached, ok := appIndexCache[directory]; ok && appIndexFprint[directory] == current {
+		return cached, nil
+	}
+
+	// Try the on-disk index
+	if index, fprint, err := readAppIndexFile(appIndexPath(directory)); err == nil && fprint == current {
+		appIndexCache[directory] = index
+		appIndexFprint[directory] = current
+		return index, nil
+	}
+
+	// Stale or missing: rebuild, reusing records whose app directory is unchanged
+	var previous *appIndex
+	if cached, ok := appIndexCache[directory]; ok {
+		previous = cached
+	} else if index, _, err := readAppIndexFile(appIndexPath(directory)); err == nil {
+		previous = index
+	}
+
+	index, err := buildAppIndex(directory, previous)
+	if err != nil {
+		return nil, err
+	}
+
+	if err := writeAppIndexFile(appIndexPath(directory), index, current); err != nil {
+		// A write failure only costs us the cache; the in-memory index is still good
+		return index, nil
+	}
+
+	appIndexCache[directory] = index
+	appIndexFprint[directory] = current
+	return index, nil
+}
+
+// buildAppIndex scans the apps tree and produces a fresh index. Records from
+// the previous index are reused when the app directory mtime is unchanged,
+// so an incremental rebuild only re-reads the apps that actually changed.
+// Status and category data are always refreshed since they live outside the
+// per-app directories and are cheap to read in one pass.
+func buildAppIndex(directory string, previous *appIndex) (*appIndex, error) {
+	appsDir := filepath.Join(directory, "apps")
+	entries, err := os.ReadDir(appsDir)
+	if err != nil {
+		return nil, fmt.Errorf("failed to read apps directory: %w", err)
+	}
+
+	// Read every status file in one pass
+	statuses := make(map[string]string)
+	statusDir := filepath.Join(directory, "data", "status")
+	if statusEntries, err := os.ReadDir(statusDir); err == nil {
+		for _, entry := range statusEntries {
+			if entry.IsDir() {
+				continue
+			}
+			if content, err := os.ReadFile(filepath.Join(statusDir, entry.Name())); err == nil {
+				statuses[entry.Name()] = strings.TrimSpace(string(content))
+			}
+		}
+	}
+
+	// Read all category assignments in one pass
+	categories := make(map[string]string)
+	if assignments, err := ReadCategoryFiles(directory); err == nil {
+		for _, assignment := range assignments {
+			parts := strings.SplitN(assignment, "|", 2)
+			if len(parts) == 2 {
+				categories[parts[0]] = parts[1]
+			}
+		}
+	}
+
+	index := &appIndex{byName: make(map[string]*appIndexEntry)}
+
+	for _, entry := range entries {
+		if !entry.IsDir() {
+			continue
+		}
+
+		appName := entry.Name()
+		info, err := entry.Info()
+		if err != nil {
+			continue
+		}
+		dirMTime := info.ModTime().Unix()
+
+		var record appIndexEntry
+
+		// Reuse the previous record if the app directory hasn't changed
+		if previous != nil {
+			if old, ok := previous.byName[appName]; ok && old.DirMTime == dirMTime && old.Flags&appIndexFlagDeprecated == 0 {
+				record = *old
+			}
+		}
+
+		if record.Name == "" {
+			record = scanAppDirectory(filepath.Join(appsDir, appName), appName, dirMTime)
+		}
+
+		// Status and category are refreshed on every rebuild
+		record.Flags &^= appIndexFlagStatusFile
+		record.Status = ""
+		if status, ok := statuses[appName]; ok {
+			record.Status = status
+			record.Flags |= appIndexFlagStatusFile
+		}
+		record.Category = categories[appName]
+
+		index.entries = append(index.entries, record)
+	}
+
+	// Include deprecated apps that still have status files, matching the
+	// behavior of getAppsWithStatus
+	deprecatedDir := filepath.Join(directory, "data", "deprecated-apps")
+	if deprecatedEntries, err := os.ReadDir(deprecatedDir); err == nil {
+		for _, entry := range deprecatedEntries {
+			if !entry.IsDir() {
+				continue
+			}
+			appName := entry.Name()
+			if _, indexed := findAppIndexEntry(index.entries, appName); indexed {
+				continue
+			}
+			status, hasStatus := statuses[appName]
+			if !hasStatus {
+				continue
+			}
+			index.entries = append(index.entries, appIndexEntry{
+				Name:     appName,
+				Status:   status,
+				Category: categories[appName],
+				Flags:    appIndexFlagStatusFile | appIndexFlagDeprecated,
+			})
+		}
+	}
+
+	sort.Slice(index.entries, func(i, j int) bool {
+		return index.entries[i].Name < index.entries[j].Name
+	})
+	for i := range index.entries {
+		index.byName[index.entries[i].Name] = &index.entries[i]
+	}
+
+	return index, nil
+}
+
+// findAppIndexEntry looks up an entry by name in an unsorted slice
+func findAppIndexEntry(entries []appIndexEntry, name string) (*appIndexEntry, bool) {
+	for i := range entries {
+		if entries[i].Name == name {
+			return &entries[i], true
+		}
+	}
+	return nil, false
+}
+
+// scanAppDirectory reads one app directory and records which files exist
+func scanAppDirectory(appDir, appName string, dirMTime int64) appIndexEntry {
+	record := appIndexEntry{Name: appName, DirMTime: dirMTime}
+
+	entries, err := os.ReadDir(appDir)
+	if err != nil {
+		return record
+	}
+
+	for _, entry := range entries {
+		if entry.IsDir() {
+			continue
+		}
+		switch entry.Name() {
+		case "install":
+			record.Flags |= appIndexFlagInstall
+		case "install-32":
+			record.Flags |= appIndexFlagInstall32
+		case "install-64":
+			record.Flags |= appIndexFlagInstall64
+		case "uninstall":
+			record.Flags |= appIndexFlagUninstall
+		case "packages":
+			record.Flags |= appIndexFlagPackages
+		case "flatpak_packages":
+			record.Flags |= appIndexFlagFlatpakPackages
+			if content, err := os.ReadFile(filepath.Join(appDir, "flatpak_packages")); err == nil {
+				record.FlatpakIDs = strings.Join(strings.Fields(string(content)), " ")
+			}
+		case "icon.png":
+			record.Flags |= appIndexFlagIcon
+		case "description":
+			record.Flags |= appIndexFlagDescription
+		}
+	}
+
+	return record
+}
+
+// writeAppIndexFile serializes the index and atomically replaces the index file
+func writeAppIndexFile(path string, index *appIndex, fingerprints [3]int64) error {
+	if err := os.MkdirAll(filepath.Dir(path), 0755); err != nil {
+		return fmt.Errorf("failed to create index directory: %w", err)
+	}
+
+	var buf bytes.Buffer
+	buf.WriteString(appIndexMagic)
+	binary.Write(&buf, binary.LittleEndian, uint16(appIndexVersion))
+	binary.Write(&buf, binary.LittleEndian, uint16(0))
+	binary.Write(&buf, binary.LittleEndian, fingerprints[0])
+	binary.Write(&buf, binary.LittleEndian, fingerprints[1])
+	binary.Write(&buf, binary.LittleEndian, fingerprints[2])
+	binary.Write(&buf, binary.LittleEndian, uint32(len(index.entries)))
+
+	writeString := func(s string) {
+		binary.Write(&buf, binary.LittleEndian, uint16(len(s)))
+		buf.WriteString(s)
+	}
+
+	for i := range index.entries {
+		record := &index.entries[i]
+		binary.Write(&buf, binary.LittleEndian, record.DirMTime)
+		binary.Write(&buf, binary.LittleEndian, record.Flags)
+		writeString(record.Name)
+		writeString(record.Status)
+		writeString(record.Category)
+		writeString(record.FlatpakIDs)
+	}
+
+	// Write to a temporary file and rename for atomicity
+	tmpFile := path + "-tmp"
+	if err := os.WriteFile(tmpFile, buf.Bytes(), 0644); err != nil {
+		return fmt.Errorf("failed to write index file: %w", err)
+	}
+	return os.Rename(tmpFile, path)
+}
+
+// readAppIndexFile maps the index file into memory and decodes it
+func readAppIndexFile(path string) (*appIndex, [3]int64, error) {
+	var fingerprints [3]int64
+
+	data, closer, err := mapIndexFile(path)
+	if err != nil {
+		return nil, fingerprints, err
+	}
+	defer closer()
+
+	if len(data) < 4+2+2+8*3+4 || string(data[:4]) != appIndexMagic {
+		return nil, fingerprints, fmt.Errorf("invalid index file: %s", path)
+	}
+
+	offset := 4
+	readUint16 := func() uint16 {
+		v := binary.LittleEndian.Uint16(data[offset:])
+		offset += 2
+		return v
+	}
+	readInt64 := func() int64 {
+		v := int64(binary.LittleEndian.Uint64(data[offset:]))
+		offset += 8
+		return v
+	}
+
+	if version := readUint16(); version != appIndexVersion {
+		return nil, fingerprints, fmt.Errorf("unsupported index version: %d", version)
+	}
+	readUint16() // reserved
+
+	fingerprints[0] = readInt64()
+	fingerprints[1] = readInt64()
+	fingerprints[2] = readInt64()
+
+	count := binary.LittleEndian.Uint32(data[offset:])
+	offset += 4
+
+	readString := func() (string, error) {
+		if offset+2 > len(data) {
+			return "", fmt.Errorf("truncated index file: %s", path)
+		}
+		length := int(binary.LittleEndian.Uint16(data[offset:]))
+		offset += 2
+		if offset+length > len(data) {
+			return "", fmt.Errorf("truncated index file: %s", path)
+		}
+		// Copy out of the mapping so the string stays valid after unmap
+		s := string(data[offset : offset+length])
+		offset += length
+		return s, nil
+	}
+
+	index := &appIndex{
+		entries: make([]appIndexEntry, 0, count),
+		byName:  make(map[string]*appIndexEntry, count),
+	}
+
+	for i := uint32(0); i < count; i++ {
+		if offset+8+2 > len(data) {
+			return nil, fingerprints, fmt.Errorf("truncated index file: %s", path)
+		}
+		var record appIndexEntry
+		record.DirMTime = readInt64()
+		record.Flags = readUint16()
+
+		var err error
+		if record.Name, err = readString(); err != nil {
+			return nil, fingerprints, err
+		}
+		if record.Status, err = readString(); err != nil {
+			return nil, fingerprints, err
+		}
+		if record.Category, err = readString(); err != nil {
+			return nil, fingerprints, err
+		}
+		if record.FlatpakIDs, err = readString(); err != nil {
+			return nil, fingerprints, err
+		}
+
+		index.entries = append(index.entries, record)
+	}
+
+	for i := range index.entries {
+		index.byName[index.entries[i].Name] = &index.entries[i]
+	}
+
+	return index, fingerprints, nil
+}
+
+// Query helpers used by the ListApps filters. All of them operate purely on
+// the decoded index, so a list query is one mmap plus an in-memory scan.
+
+// localApps returns all indexed apps that qualify as local apps
+// (install script, packages file, or flatpak_packages file present)
+func (idx *appIndex) localApps() []string {
+	var apps []string
+	for i := range idx.entries {
+		record := &idx.entries[i]
+		if record.Flags&appIndexFlagDeprecated != 0 {
+			continue
+		}
+		if record.Flags&(appIndexFlagInstall|appIndexFlagPackages|appIndexFlagFlatpakPackages) != 0 {
+			apps = append(apps, record.Name)
+		}
+	}
+	return apps
+}
+
+// appsWithStatus returns apps filtered by installed state. Installed means a
+// status file exists, matching checkAppInstalled.
+func (idx *appIndex) appsWithStatus(wantInstalled bool) []string {
+	var apps []string
+	for i := range idx.entries {
+		record := &idx.entries[i]
+		if record.Flags&appIndexFlagDeprecated == 0 &&
+			record.Flags&(appIndexFlagInstall|appIndexFlagPackages|appIndexFlagFlatpakPackages) == 0 {
+			continue
+		}
+		isInstalled := record.Flags&appIndexFlagStatusFile != 0
+		if (wantInstalled && isInstalled) || (!wantInstalled && !isInstalled) {
+			apps = append(apps, record.Name)
+		}
+	}
+	return apps
+}
+
+// appsWithStatusContent returns apps whose status file contains exactly the
+// given content
+func (idx *appIndex) appsWithStatusContent(statusContent string) []string {
+	var apps []string
+	for i := range idx.entries {
+		record := &idx.entries[i]
+		if record.Flags&appIndexFlagStatusFile != 0 && record.Status == statusContent {
+			apps = append(apps, record.Name)
+		}
+	}
+	return apps
+}
+
+// appsWithStatusFiles returns apps that have a status file
+func (idx *appIndex) appsWithStatusFiles() []string {
+	var apps []string
+	for i := range idx.entries {
+		record := &idx.entries[i]
+		if record.Flags&appIndexFlagStatusFile != 0 {
+			apps = append(apps, record.Name)
+		}
+	}
+	return apps
+}
+
+// corruptedApps returns local apps missing install/uninstall scripts, an
+// icon, or a description
+func (idx *appIndex) corruptedApps() []string {
+	var apps []string
+	required := uint16(appIndexFlagInstall | appIndexFlagUninstall | appIndexFlagIcon | appIndexFlagDescription)
+	for _, name := range idx.localApps() {
+		record := idx.byName[name]
+		if record.Flags&required != required {
+			apps = append(apps, name)
+		}
+	}
+	return apps
+}
+
+// cpuInstallableApps returns apps installable on the given architecture
+// ("32" or "64"). Flatpak-only apps are checked against the flatpak
+// compatibility database just like the filesystem walker does.
+func (idx *appIndex) cpuInstallableApps(arch string) []string {
+	archFlag := uint16(appIndexFlagInstall32)
+	if arch == "64" {
+		archFlag = appIndexFlagInstall64
+	}
+
+	var apps []string
+	for i := range idx.entries {
+		record := &idx.entries[i]
+		if record.Flags&appIndexFlagDeprecated != 0 {
+			continue
+		}
+		if record.Flags&(appIndexFlagInstall|appIndexFlagPackages|archFlag) != 0 {
+			apps = append(apps, record.Name)
+			continue
+		}
+		if record.Flags&appIndexFlagFlatpakPackages != 0 {
+			allCompatible := true
+			for _, id := range strings.Fields(record.FlatpakIDs) {
+				if !IsFlatpakAppCompatibleWithArch(id, arch) {
+					allCompatible = false
+					break
+				}
+			}
+			if allCompatible {
+				apps = append(apps, record.Name)
+			}
+		}
+	}
+	return apps
+}
+
+// multiInstallCandidates returns the apps the multi-install dialog offers:
+// cpu-installable apps that are neither in the hidden category nor have a
+// status file. One pass over the index replaces the three separate ListApps
+// calls (cpu_installable, hidden, installed) the dialog previously combined,
+// each of which revalidated the index fingerprints on its own.
+func (idx *appIndex) multiInstallCandidates(arch string) []string {
+	var apps []string
+	for _, name := range idx.cpuInstallableApps(arch) {
+		record := idx.byName[name]
+		if record.Category == "hidden" {
+			continue
+		}
+		if record.Flags&appIndexFlagStatusFile != 0 {
+			continue
+		}
+		apps = append(apps, name)
+	}
+	return apps
+}
+
+// appsWithPackagesFile returns apps that have a "packages" file
+func (idx *appIndex) appsWithPackagesFile() []string {
+	var apps []string
+	for i := range idx.entries {
+		record := &idx.entries[i]
+		if record.Flags&appIndexFlagPackages != 0 {
+			apps = append(apps, record.Name)
+		}
+	}
+	return apps
+}
+
+// standardApps returns apps that have install or uninstall scripts
+func (idx *appIndex) standardApps() []string {
+	scriptFlags := uint16(appIndexFlagInstall | appIndexFlagInstall32 | appIndexFlagInstall64 | appIndexFlagUninstall)
+	var apps []string
+	for i := range idx.entries {
+		record := &idx.entries[i]
+		if record.Flags&appIndexFlagDeprecated != 0 {
+			continue
+		}
+		if record.Flags&scriptFlags != 0 {
+			apps = append(apps, record.Name)
+		}
+	}
+	return apps
+}
+
+// noteAppStatusChange folds a single status-file write into the cached index
+// so the next list query revalidates instead of rebuilding. Only the changed
+// entry and the status-directory fingerprint are refreshed, keeping the cost
+// proportional to what actually changed rather than to the number of apps.
+// Apps not in the index yet are left for the normal incremental rebuild.
+func noteAppStatusChange(directory, appName, status string) {
+	appIndexMu.Lock()
+	defer appIndexMu.Unlock()
+
+	index, ok := appIndexCache[directory]
+	if !ok {
+		return
+	}
+	entry, ok := index.byName[appName]
+	if !ok {
+		return
+	}
+
+	entry.Status = strings.TrimSpace(status)
+	entry.Flags |= appIndexFlagStatusFile
+
+	fingerprints := appIndexFprint[directory]
+	fingerprints[1] = dirFingerprint(filepath.Join(directory, "data", "status"))
+	appIndexFprint[directory] = fingerprints
+
+	// Persist so other processes revalidate against the new fingerprint too;
+	// a write failure only costs the on-disk cache
+	_ = writeAppIndexFile(appIndexPath(directory), index, fingerprints)
+}
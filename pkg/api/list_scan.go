@@ -0,0 +1,124 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: list_scan.go
+// Description: Shared concurrent scanner for the app enumeration helpers.
+// A single os.ReadDir pass over the apps directory feeds a bounded worker
+// pool, so independent per-app stat/read work overlaps instead of running
+// serially.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"io/fs"
+	"os"
+	"path/filepath"
+	"runtime"
+	"sync"
+)
+
+// scanAppDirs reads the apps directory once and calls fn concurrently for
+// each app subdirectory, passing the app name, its full path, and its
+// directory listing. The worker pool is bounded to GOMAXPROCS so a full
+// scan scales with core count without flooding slow storage. fn is invoked
+// from multiple goroutines and must synchronize its own writes.
+func scanAppDirs(appsDir string, fn func(appName, appDir string, files []fs.DirEntry)) error {
+	entries, err := os.ReadDir(appsDir)
+	if err != nil {
+		return err
+	}
+
+	jobs := make(chan fs.DirEntry)
+	var wg sync.WaitGroup
+
+	workers := runtime.GOMAXPROCS(0)
+	if workers > len(entries) {
+		workers = len(entries)
+	}
+	if workers < 1 {
+		workers = 1
+	}
+
+	for i := 0; i < workers; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for entry := range jobs {
+				appDir := filepath.Join(appsDir, entry.Name())
+				files, err := os.ReadDir(appDir)
+				if err != nil {
+					continue // Skip unreadable app directories
+				}
+				fn(entry.Name(), appDir, files)
+			}
+		}()
+	}
+
+	for _, entry := range entries {
+		if !entry.IsDir() || shouldSkipDirectory(filepath.Join(appsDir, entry.Name()), entry) {
+			continue
+		}
+		jobs <- entry
+	}
+	close(jobs)
+	wg.Wait()
+
+	return nil
+}
+
+// forEachApp runs fn concurrently for each app name using the same bounded
+// worker pool sizing as scanAppDirs. Used by helpers that already have an
+// app list and only need to overlap per-app stat/read work.
+func forEachApp(apps []string, fn func(app string)) {
+	jobs := make(chan string)
+	var wg sync.WaitGroup
+
+	workers := runtime.GOMAXPROCS(0)
+	if workers > len(apps) {
+		workers = len(apps)
+	}
+	if workers < 1 {
+		workers = 1
+	}
+
+	for i := 0; i < workers; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for app := range jobs {
+				fn(app)
+			}
+		}()
+	}
+
+	for _, app := range apps {
+		jobs <- app
+	}
+	close(jobs)
+	wg.Wait()
+}
+
+// dirEntriesContain reports whether a directory listing contains a file
+// with the given name
+func dirEntriesContain(files []fs.DirEntry, name string) bool {
+	for _, file := range files {
+		if !file.IsDir() && file.Name() == name {
+			return true
+		}
+	}
+	return false
+}
@@ -28,8 +28,136 @@ import (
 	"os"
 	"regexp"
 	"strings"
+	"sync"
 )
 
+// logDiagnosePatterns lists the literal substrings checked by LogDiagnose.
+// They are compiled into one Aho-Corasick automaton (lazily, once per
+// process) so each log is scanned a single time for all of them.
+var logDiagnosePatterns = []string{
+	"ERROR: unable to select packages",
+	"(no such package)",
+	"ERROR: unsatisfiable constraints",
+	"WARNING: This apk-tools is OLD!",
+	"apk-tools is OLD",
+	"ERROR: BAD signature",
+	"UNTRUSTED signature",
+	"signature verification failed",
+	"ERROR: Not committing changes due to missing repository tags",
+	"missing repository tags",
+	"ERROR:",
+	"/etc/apk/world",
+	"virtual",
+}
+
+// Regexes used by the log diagnosis checks. They are compiled together the
+// first time a log is diagnosed, so a batch of failed apps only pays the
+// compilation cost once per process.
+var (
+	logDiagnoseRegexOnce sync.Once
+
+	regexFetchFailed               *regexp.Regexp
+	regexCacheError                *regexp.Regexp
+	regexPermission                *regexp.Regexp
+	regexBroken                    *regexp.Regexp
+	regexArch                      *regexp.Regexp
+	regexCorrupted                 *regexp.Regexp
+	regexScript                    *regexp.Regexp
+	regexDependencyConflict        *regexp.Regexp
+	regexInternetError             *regexp.Regexp
+	regexFetchPack                 *regexp.Regexp
+	regexFatalObject               *regexp.Regexp
+	regexRemoteEndHungUp           *regexp.Regexp
+	regexSslError                  *regexp.Regexp
+	regexCurlError                 *regexp.Regexp
+	regexAuthorizationFailed       *regexp.Regexp
+	regexFlathubError              *regexp.Regexp
+	regexTlsError                  *regexp.Regexp
+	regexGnuTlsError               *regexp.Regexp
+	regexConnectException          *regexp.Regexp
+	regexCrateNotFound             *regexp.Regexp
+	regexCargoNetwork              *regexp.Regexp
+	regexHashDoesNotMatch          *regexp.Regexp
+	regexModuleNotFound            *regexp.Regexp
+	regexAppmenuGtkModule          *regexp.Regexp
+	regexGnupg                     *regexp.Regexp
+	regexDBus                      *regexp.Regexp
+	regexSudoers                   *regexp.Regexp
+	regexIncorrectPassword         *regexp.Regexp
+	regexSudoOperationNotPermitted *regexp.Regexp
+	regexCpp                       *regexp.Regexp
+	regexTar                       *regexp.Regexp
+	regexXz                        *regexp.Regexp
+	regexStructureNeedsCleaning    *regexp.Regexp
+	regexFlatpak                   *regexp.Regexp
+	regexSpace                     *regexp.Regexp
+	regexAutostart                 *regexp.Regexp
+	regexCache                     *regexp.Regexp
+	regexMkdir                     *regexp.Regexp
+	regexSegfault                  *regexp.Regexp
+	regexKilled                    *regexp.Regexp
+	regexRustKilled                *regexp.Regexp
+	regexRustVersion               *regexp.Regexp
+	regexCargoPermission           *regexp.Regexp
+	regexRustOOM                   *regexp.Regexp
+	regexRustTarget                *regexp.Regexp
+	regexUserError                 *regexp.Regexp
+	regexUserErrorAllowed          *regexp.Regexp
+)
+
+// compileLogDiagnoseRegexes compiles the diagnosis pattern table on first use
+func compileLogDiagnoseRegexes() {
+	logDiagnoseRegexOnce.Do(func() {
+		regexFetchFailed = regexp.MustCompile(`ERROR:.*fetch.*failed|ERROR:.*: temporary error|ERROR:.*: Network unreachable|ERROR:.*: Connection timed out`)
+		regexCacheError = regexp.MustCompile(`ERROR:.*cache|ERROR:.*APKINDEX`)
+		regexPermission = regexp.MustCompile(`ERROR:.*[Pp]ermission denied|ERROR:.*Operation not permitted`)
+		regexBroken = regexp.MustCompile(`ERROR:.*broken|Use --force-broken-world`)
+		regexArch = regexp.MustCompile(`ERROR:.*architecture.*not supported|ERROR:.*wrong architecture`)
+		regexCorrupted = regexp.MustCompile(`ERROR:.*corrupted|ERROR:.*checksum.*failed|ERROR:.*integrity.*failed`)
+		regexScript = regexp.MustCompile(`ERROR:.*\.post-install|ERROR:.*\.pre-install|ERROR:.*\.post-upgrade|ERROR:.*\.pre-upgrade|ERROR:.*\.post-deinstall|ERROR:.*\.pre-deinstall`)
+		regexDependencyConflict = regexp.MustCompile(`error: failed to select a version for the requirement.*version conflict`)
+		regexInternetError = regexp.MustCompile(`Could not resolve host: github\.com|Failed to connect to github\.com port 443: Connection timed out`)
+		regexFetchPack = regexp.MustCompile(`fetch-pack: unexpected disconnect while reading sideband packet`)
+		regexFatalObject = regexp.MustCompile(`fatal: did not receive expected object`)
+		regexRemoteEndHungUp = regexp.MustCompile(`fatal: the remote end hung up unexpectedly`)
+		regexSslError = regexp.MustCompile(`SSL/TLS handshake failure|total length mismatch|failed to establish connection|timeout|connection reset by peer|name resolution failed|temporary failure in name resolution|unable to establish SSL connection|connection closed at byte|read error at byte|failed: No route to host|invalid range header|curl error|response status not successful|download snap|dial tcp|lookup api\.snapcraft\.io|fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server|RPC failed; curl .* transfer closed with outstanding read data remaining|RPC failed; curl .* GnuTLS recv error \(-9\): A TLS packet with unexpected length was received\.|SSL error|failure when receiving data from the peer|java\.net\.SocketTimeoutException: Read timed out`)
+		regexCurlError = regexp.MustCompile(`curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR \(err .*\)`)
+		regexAuthorizationFailed = regexp.MustCompile(`errorCode=24 Authorization failed.`)
+		regexFlathubError = regexp.MustCompile(`flathub: Error resolving .*dl\.flathub\.org`)
+		regexTlsError = regexp.MustCompile(`The TLS connection was non-properly terminated\.|Can't load uri .* Unacceptable TLS certificate`)
+		regexGnuTlsError = regexp.MustCompile(`GnuTLS recv error \(-54\): Error in the pull function\.`)
+		regexConnectException = regexp.MustCompile(`java\.net\.ConnectException: Connection refused`)
+		regexCrateNotFound = regexp.MustCompile(`error: failed to get .*? as a dependency.*no matching package named`)
+		regexCargoNetwork = regexp.MustCompile(`error: failed to fetch from.*could not connect to server|error: failed to fetch.*Network is unreachable`)
+		regexHashDoesNotMatch = regexp.MustCompile(`ERROR: Downloaded system image hash doesn't match, expected`)
+		regexModuleNotFound = regexp.MustCompile(`modprobe: FATAL: Module .* not found in directory`)
+		regexAppmenuGtkModule = regexp.MustCompile(`Failed to load module "appmenu-gtk-module"`)
+		regexGnupg = regexp.MustCompile(`gnupg.*do not seem to be installed`)
+		regexDBus = regexp.MustCompile(`error: Unable to connect to system bus|error: Message recipient disconnected from message bus without replying|Failed to connect to bus: Host is down`)
+		regexSudoers = regexp.MustCompile(`is not in the sudoers file\.  This incident will be reported\.`)
+		regexIncorrectPassword = regexp.MustCompile(`sudo: .* incorrect password attempts`)
+		regexSudoOperationNotPermitted = regexp.MustCompile(`/usr/bin/sudo: Operation not permitted`)
+		regexCpp = regexp.MustCompile(`cpp\.o: file not recognized: file truncated`)
+		regexTar = regexp.MustCompile(`tar: Unexpected EOF in archive|xz: \(stdin\): Unexpected end of input|xz: \(stdin\): Compressed data is corrupt|xz: \(stdin\): File format not recognized|gzip: stdin: invalid compressed data--length error|gzip: stdin: invalid compressed data--crc error|corrupted filesystem tarfile in package archive: invalid tar header size field \(Invalid argument\)|member 'data\.tar': internal gzip read error: '<fd:4>: incorrect data check|error inflating zlib stream`)
+		regexXz = regexp.MustCompile(`xz: Cannot exec: No such file or directory`)
+		regexStructureNeedsCleaning = regexp.MustCompile(`Structure needs cleaning`)
+		regexFlatpak = regexp.MustCompile(`Error: Failed to read commit .* No such metadata object|error: Failed to install org\.freedesktop\.Platform: Failed to read commit .* No such metadata object|Error: Error deploying: .* No such metadata object`)
+		regexSpace = regexp.MustCompile(`No space left on device|Not enough disk space to complete this operation|You don't have enough free space in|Cannot write to .* \(Success\)\.`)
+		regexAutostart = regexp.MustCompile(`: line .*: \$HOME/\.config/autostart/.*\.desktop: Permission denied`)
+		regexCache = regexp.MustCompile(`The directory '(\$HOME|\$\{HOME\}|/home/[^/]+)/\.cache/pip' or its parent directory is not owned by the current user`)
+		regexMkdir = regexp.MustCompile(`mkdir: cannot create directory .*/home/[^/]+/pi-apps-.*: Permission denied|rm: cannot remove .*/home/[^/]+/.*: Permission denied`)
+		regexSegfault = regexp.MustCompile(`collect2: fatal error: ld terminated with signal 11 \[Segmentation fault\]`)
+		regexKilled = regexp.MustCompile(`c\+\+: fatal error: Killed signal terminated program cc1plus`)
+		regexRustKilled = regexp.MustCompile(`process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)`)
+		regexRustVersion = regexp.MustCompile(`error: the current.*rustc .* is older than the minimum version required`)
+		regexCargoPermission = regexp.MustCompile(`failed to get metadata for.*: permission denied: .*\.cargo`)
+		regexRustOOM = regexp.MustCompile(`(LLVM ERROR: out of memory|rustc.*internal compiler error.*out of memory|killed by the OOM killer)`)
+		regexRustTarget = regexp.MustCompile(`error: failed to run custom build command for.*cross-compil|error: failed to run rustc to learn about target-specific information`)
+		regexUserError = regexp.MustCompile(`(?m)^User error: `)
+		regexUserErrorAllowed = regexp.MustCompile(`(?m)^User error \(reporting allowed\): `)
+	})
+}
+
 // LogDiagnose analyzes a logfile and returns diagnostic information
 //
 // It takes a logfile path and an allowWrite parameter
@@ -37,6 +165,8 @@ import (
 //	ErrorDiagnosis - the error diagnosis
 //	error - error if logfile is not specified
 func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
+	compileLogDiagnoseRegexes()
+
 	// Read the logfile
 	content, err := os.ReadFile(logfilePath)
 	if err != nil {
@@ -45,6 +175,9 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 
 	errors := string(content)
 
+	// Match every literal error pattern in a single pass over the log
+	logMatches := scanLogPatterns(errors, logDiagnosePatterns)
+
 	// Determine the actual log file path to write to - used when implementing write functionality
 	// Currently not used in this implementation
 	_ = logfilePath
@@ -66,8 +199,8 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	//------------------------------------------
 
 	// Check for 'ERROR: unable to select packages' or 'no such package'
-	if strings.Contains(errors, "ERROR: unable to select packages") ||
-		strings.Contains(errors, "(no such package)") {
+	if logMatches.contains("ERROR: unable to select packages") ||
+		logMatches.contains("(no such package)") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK reported that the requested package(s) could not be found.\n\n"+
 				"This could be because:\n"+
@@ -81,7 +214,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for 'ERROR: unsatisfiable constraints'
-	if strings.Contains(errors, "ERROR: unsatisfiable constraints") {
+	if logMatches.contains("ERROR: unsatisfiable constraints") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK reported dependency conflicts that cannot be resolved.\n\n"+
 				"This happens when a package requires dependencies that conflict with other installed packages or cannot be found in available repositories.\n\n"+
@@ -94,8 +227,8 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for 'WARNING: This apk-tools is OLD!'
-	if strings.Contains(errors, "WARNING: This apk-tools is OLD!") ||
-		strings.Contains(errors, "apk-tools is OLD") {
+	if logMatches.contains("WARNING: This apk-tools is OLD!") ||
+		logMatches.contains("apk-tools is OLD") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your apk-tools package manager is outdated.\n\n"+
 				"An outdated apk-tools can cause package installation failures and compatibility issues.\n\n"+
@@ -107,9 +240,9 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for 'ERROR: BAD signature' or 'UNTRUSTED signature'
-	if strings.Contains(errors, "ERROR: BAD signature") ||
-		strings.Contains(errors, "UNTRUSTED signature") ||
-		strings.Contains(errors, "signature verification failed") {
+	if logMatches.contains("ERROR: BAD signature") ||
+		logMatches.contains("UNTRUSTED signature") ||
+		logMatches.contains("signature verification failed") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK reported a bad or untrusted signature.\n\n"+
 				"This can happen when:\n"+
@@ -124,8 +257,8 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for 'ERROR: Not committing changes due to missing repository tags'
-	if strings.Contains(errors, "ERROR: Not committing changes due to missing repository tags") ||
-		strings.Contains(errors, "missing repository tags") {
+	if logMatches.contains("ERROR: Not committing changes due to missing repository tags") ||
+		logMatches.contains("missing repository tags") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK cannot commit changes because repository tags are missing.\n\n"+
 				"This indicates that the APK index is not properly set up or is corrupted.\n\n"+
@@ -137,7 +270,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for repository fetch failures
-	regexFetchFailed := regexp.MustCompile(`ERROR:.*fetch.*failed|ERROR:.*: temporary error|ERROR:.*: Network unreachable|ERROR:.*: Connection timed out`)
 	if regexFetchFailed.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK failed to fetch packages from the repository.\n\n"+
@@ -150,7 +282,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for network resolution errors
-	if strings.Contains(errors, "ERROR:") &&
+	if logMatches.contains("ERROR:") &&
 		containsAny(errors, []string{
 			"Could not resolve host",
 			"Name or service not known",
@@ -165,7 +297,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for world file issues
-	if strings.Contains(errors, "ERROR:") && strings.Contains(errors, "/etc/apk/world") {
+	if logMatches.contains("ERROR:") && logMatches.contains("/etc/apk/world") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK encountered issues with the world file (/etc/apk/world).\n\n"+
 				"The world file tracks explicitly installed packages. If it's corrupted, APK cannot function properly.\n\n"+
@@ -177,7 +309,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cache issues
-	regexCacheError := regexp.MustCompile(`ERROR:.*cache|ERROR:.*APKINDEX`)
 	if regexCacheError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK encountered cache or index issues.\n\n"+
@@ -188,7 +319,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for disk space issues
-	if strings.Contains(errors, "ERROR:") &&
+	if logMatches.contains("ERROR:") &&
 		containsAny(errors, []string{
 			"No space left on device",
 			"not enough disk space",
@@ -204,7 +335,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for permission errors
-	regexPermission := regexp.MustCompile(`ERROR:.*[Pp]ermission denied|ERROR:.*Operation not permitted`)
 	if regexPermission.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK encountered permission errors.\n\n"+
@@ -215,7 +345,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for locked database
-	if strings.Contains(errors, "ERROR:") &&
+	if logMatches.contains("ERROR:") &&
 		containsAny(errors, []string{
 			"database is locked",
 			"Unable to lock database",
@@ -230,7 +360,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for broken packages or world file errors
-	regexBroken := regexp.MustCompile(`ERROR:.*broken|Use --force-broken-world`)
 	if regexBroken.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK detected broken packages or world file inconsistencies.\n\n"+
@@ -243,7 +372,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for virtual package errors
-	if strings.Contains(errors, "ERROR:") && strings.Contains(errors, "virtual") {
+	if logMatches.contains("ERROR:") && logMatches.contains("virtual") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK encountered an error with virtual packages.\n\n"+
 				"Virtual packages are meta-packages that group multiple packages together.\n\n"+
@@ -254,7 +383,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for --simulate or --no-commit-hooks related errors
-	if strings.Contains(errors, "ERROR:") &&
+	if logMatches.contains("ERROR:") &&
 		containsAny(errors, []string{
 			"simulated",
 			"would install",
@@ -266,7 +395,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for architecture mismatch
-	regexArch := regexp.MustCompile(`ERROR:.*architecture.*not supported|ERROR:.*wrong architecture`)
 	if regexArch.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK reported an architecture mismatch.\n\n"+
@@ -276,7 +404,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for version conflicts
-	if strings.Contains(errors, "ERROR:") &&
+	if logMatches.contains("ERROR:") &&
 		containsAny(errors, []string{
 			"version conflict",
 			"conflicts with",
@@ -291,7 +419,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for missing dependencies during package building
-	if strings.Contains(errors, "ERROR:") &&
+	if logMatches.contains("ERROR:") &&
 		containsAny(errors, []string{
 			"build dependencies",
 			"makedepends",
@@ -309,7 +437,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	//------------------------------------------
 
 	// Check for corrupted package files
-	regexCorrupted := regexp.MustCompile(`ERROR:.*corrupted|ERROR:.*checksum.*failed|ERROR:.*integrity.*failed`)
 	if regexCorrupted.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APK detected corrupted package files.\n\n"+
@@ -324,7 +451,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for script errors
-	regexScript := regexp.MustCompile(`ERROR:.*\.post-install|ERROR:.*\.pre-install|ERROR:.*\.post-upgrade|ERROR:.*\.pre-upgrade|ERROR:.*\.post-deinstall|ERROR:.*\.pre-deinstall`)
 	if regexScript.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"A package installation/removal script failed.\n\n"+
@@ -341,7 +467,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// cargo package errors below
 
 	// Check for incompatible dependencies
-	regexDependencyConflict := regexp.MustCompile(`error: failed to select a version for the requirement.*version conflict`)
 	if regexDependencyConflict.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed due to conflicting dependency requirements.\n\n"+
@@ -353,7 +478,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// internet errors below
 
 	// check for "Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out" aka internet errors
-	regexInternetError := regexp.MustCompile(`Could not resolve host: github\.com|Failed to connect to github\.com port 443: Connection timed out`)
 	if regexInternetError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to connect to github.com.\n\n"+
@@ -362,7 +486,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fetch-pack: unexpected disconnect while reading sideband packet" aka git errors
-	regexFetchPack := regexp.MustCompile(`fetch-pack: unexpected disconnect while reading sideband packet`)
 	if regexFetchPack.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fetch-pack: unexpected disconnect while reading sideband packet\" Check the stability of your Internet connection and try again. \n\n"+
@@ -371,7 +494,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fatal: did not receive expected object" aka git errors
-	regexFatalObject := regexp.MustCompile(`fatal: did not receive expected object`)
 	if regexFatalObject.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fatal: did not receive expected object\" Check the stability of your Internet connection and try again.\n\n"+
@@ -380,7 +502,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fatal: the remote end hung up unexpectedly" aka git errors
-	regexRemoteEndHungUp := regexp.MustCompile(`fatal: the remote end hung up unexpectedly`)
 	if regexRemoteEndHungUp.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fatal: the remote end hung up unexpectedly\" Check the stability of your Internet connection and try again.\n\n"+
@@ -389,7 +510,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for SSL/TLS handshake failure, total length mismatch, failed to establish connection, timeout, connection reset by peer, name resolution failed, temporary failure in name resolution, unable to establish SSL connection, connection closed at byte, read error at byte, failed: No route to host, invalid range header, curl error, response status not successful, download snap, dial tcp, lookup api.snapcraft.io, fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server, RPC failed; curl .* transfer closed with outstanding read data remaining, RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received., SSL error, failure when receiving data from the peer, java.net.SocketTimeoutException: Read timed out which include git errors
-	regexSslError := regexp.MustCompile(`SSL/TLS handshake failure|total length mismatch|failed to establish connection|timeout|connection reset by peer|name resolution failed|temporary failure in name resolution|unable to establish SSL connection|connection closed at byte|read error at byte|failed: No route to host|invalid range header|curl error|response status not successful|download snap|dial tcp|lookup api\.snapcraft\.io|fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server|RPC failed; curl .* transfer closed with outstanding read data remaining|RPC failed; curl .* GnuTLS recv error \(-9\): A TLS packet with unexpected length was received\.|SSL error|failure when receiving data from the peer|java\.net\.SocketTimeoutException: Read timed out`)
 	if regexSslError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"A network operation encountered SSL/TLS or connection errors. Check the stability of your Internet connection and try again.")
@@ -397,7 +517,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)"
-	regexCurlError := regexp.MustCompile(`curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR \(err .*\)`)
 	if regexCurlError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed due to an internal curl error. This could be an internet issue or hardware problem. \n"+
@@ -406,7 +525,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "errorCode=24 Authorization failed."
-	regexAuthorizationFailed := regexp.MustCompile(`errorCode=24 Authorization failed.`)
 	if regexAuthorizationFailed.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The curl command encountered this error: \"errorCode=24 Authorization failed.\" Check the stability of your Internet connection and try again.")
@@ -414,7 +532,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "flathub: Error resolving .dl\.flathub\.org."
-	regexFlathubError := regexp.MustCompile(`flathub: Error resolving .*dl\.flathub\.org`)
 	if regexFlathubError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The flathub command encountered a DNS resolution error. Check the stability of your Internet connection and try again.")
@@ -422,7 +539,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate"
-	regexTlsError := regexp.MustCompile(`The TLS connection was non-properly terminated\.|Can't load uri .* Unacceptable TLS certificate`)
 	if regexTlsError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The TLS connection was non-properly terminated. Check the stability of your Internet connection and try again.")
@@ -430,7 +546,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "GnuTLS recv error (-54): Error in the pull function."
-	regexGnuTlsError := regexp.MustCompile(`GnuTLS recv error \(-54\): Error in the pull function\.`)
 	if regexGnuTlsError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed due to an issue with your internet, not Pi-Apps. The connection was terminated before the download completed. \n\n"+
@@ -440,7 +555,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "java.net.ConnectException: Connection refused"
-	regexConnectException := regexp.MustCompile(`java\.net\.ConnectException: Connection refused`)
 	if regexConnectException.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed. Check your internet connection and firewall, then try again.")
@@ -448,7 +562,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cargo crate not found error
-	regexCrateNotFound := regexp.MustCompile(`error: failed to get .*? as a dependency.*no matching package named`)
 	if regexCrateNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because a required crate dependency was not found.\n\n"+
@@ -461,7 +574,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cargo network errors
-	regexCargoNetwork := regexp.MustCompile(`error: failed to fetch from.*could not connect to server|error: failed to fetch.*Network is unreachable`)
 	if regexCargoNetwork.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Cargo couldn't connect to the crates.io registry or other dependency sources.\n\n"+
@@ -470,7 +582,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for ERROR: Downloaded system image hash doesn't match, expected <hash> from Waydroid
-	regexHashDoesNotMatch := regexp.MustCompile(`ERROR: Downloaded system image hash doesn't match, expected`)
 	if regexHashDoesNotMatch.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Waydroid OS image download failed. Check your internet connection and firewall, then try again.")
@@ -480,7 +591,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// other system errors below
 
 	// check for modprobe: FATAL: Module .* not found in directory
-	regexModuleNotFound := regexp.MustCompile(`modprobe: FATAL: Module .* not found in directory`)
 	if regexModuleNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with the kernel modules. Try rebooting if your kernel was upgraded. \n\n"+
@@ -489,7 +599,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Failed to load module \"appmenu-gtk-module\""
-	regexAppmenuGtkModule := regexp.MustCompile(`Failed to load module "appmenu-gtk-module"`)
 	if regexAppmenuGtkModule.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"This error occurred: Failed to load module \"appmenu-gtk-module\" \n\n"+
@@ -500,7 +609,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "E: gnupg, gnupg2 and gnupg1 do not seem to be installed, but one of them is required for this operation"
-	regexGnupg := regexp.MustCompile(`gnupg.*do not seem to be installed`)
 	if regexGnupg.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Repository-signing failed because gnupg is missing. This is installed by default on most systems, but on yours it's missing for some reason. \n\n"+
@@ -510,7 +618,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down"
-	regexDBus := regexp.MustCompile(`error: Unable to connect to system bus|error: Message recipient disconnected from message bus without replying|Failed to connect to bus: Host is down`)
 	if regexDBus.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with your dbus connection. \n\n"+
@@ -521,7 +628,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "is not in the sudoers file.  This incident will be reported."
-	regexSudoers := regexp.MustCompile(`is not in the sudoers file\.  This incident will be reported\.`)
 	if regexSudoers.MatchString(errors) {
 		currentUser := os.Getenv("USER")
 		if currentUser == "" {
@@ -535,7 +641,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "sudo: .* incorrect password attempts"
-	regexIncorrectPassword := regexp.MustCompile(`sudo: .* incorrect password attempts`)
 	if regexIncorrectPassword.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because you failed to type in the correct sudo password. \n\n"+
@@ -544,7 +649,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "/usr/bin/sudo: Operation not permitted"
-	regexSudoOperationNotPermitted := regexp.MustCompile(`/usr/bin/sudo: Operation not permitted`)
 	if regexSudoOperationNotPermitted.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because your sudo command is incorrectly set up. \n"+
@@ -554,7 +658,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "cpp.o: file not recognized: file truncated"
-	regexCpp := regexp.MustCompile(`cpp\.o: file not recognized: file truncated`)
 	if regexCpp.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed. Try again, but please reach out to Pi-Apps developers for help if this same error keeps occurring.")
@@ -562,7 +665,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;"
-	regexTar := regexp.MustCompile(`tar: Unexpected EOF in archive|xz: \(stdin\): Unexpected end of input|xz: \(stdin\): Compressed data is corrupt|xz: \(stdin\): File format not recognized|gzip: stdin: invalid compressed data--length error|gzip: stdin: invalid compressed data--crc error|corrupted filesystem tarfile in package archive: invalid tar header size field \(Invalid argument\)|member 'data\.tar': internal gzip read error: '<fd:4>: incorrect data check|error inflating zlib stream`)
 	if regexTar.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Extraction failed. Most likely this was a corrupted download, so please try again. \n\n"+
@@ -571,7 +673,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "xz: Cannot exec: No such file or directory"
-	regexXz := regexp.MustCompile(`xz: Cannot exec: No such file or directory`)
 	if regexXz.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Extraction failed because XZ is not installed. \n\n"+
@@ -581,7 +682,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Structure needs cleaning"
-	regexStructureNeedsCleaning := regexp.MustCompile(`Structure needs cleaning`)
 	if regexStructureNeedsCleaning.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"You have encountered the dreaded \"Structure needs cleaning\" error. This indicates file-corruption caused by improperly shutting down your computer. You are lucky your computer booted at all.\n\n"+
@@ -593,7 +693,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object"
-	regexFlatpak := regexp.MustCompile(`Error: Failed to read commit .* No such metadata object|error: Failed to install org\.freedesktop\.Platform: Failed to read commit .* No such metadata object|Error: Error deploying: .* No such metadata object`)
 	if regexFlatpak.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Flatpak failed to install something due to a past incomplete download. \n\n"+
@@ -604,7 +703,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "No space left on device" (duplicate check but keeping for consistency)
-	regexSpace := regexp.MustCompile(`No space left on device|Not enough disk space to complete this operation|You don't have enough free space in|Cannot write to .* \(Success\)\.`)
 	if regexSpace.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your system has insufficient disk space.\n\n"+
@@ -613,7 +711,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for permission denied when creating autostart entries
-	regexAutostart := regexp.MustCompile(`: line .*: \$HOME/\.config/autostart/.*\.desktop: Permission denied`)
 	if regexAutostart.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -630,7 +727,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "The directory '$HOME/\.cache/pip' or its parent directory is not owned by the current user"
-	regexCache := regexp.MustCompile(`The directory '(\$HOME|\$\{HOME\}|/home/[^/]+)/\.cache/pip' or its parent directory is not owned by the current user`)
 	if regexCache.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -653,7 +749,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "mkdir: cannot create directory .*/home/username/pi-apps-.*: Permission denied"
-	regexMkdir := regexp.MustCompile(`mkdir: cannot create directory .*/home/[^/]+/pi-apps-.*: Permission denied|rm: cannot remove .*/home/[^/]+/.*: Permission denied`)
 	if regexMkdir.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -670,7 +765,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for segmentation fault from linker
-	regexSegfault := regexp.MustCompile(`collect2: fatal error: ld terminated with signal 11 \[Segmentation fault\]`)
 	if regexSegfault.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to compile! The error was: \"collect2: fatal error: ld terminated with signal 11 [Segmentation fault]\"\n\n"+
@@ -679,7 +773,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "c++: fatal error: Killed signal terminated program cc1plus"
-	regexKilled := regexp.MustCompile(`c\+\+: fatal error: Killed signal terminated program cc1plus`)
 	if regexKilled.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed because cc1plus was killed due to insufficient RAM.\n\n"+
@@ -689,7 +782,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)"
-	regexRustKilled := regexp.MustCompile(`process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)`)
 	if regexRustKilled.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed because rustc was killed due to insufficient RAM.\n"+
@@ -699,7 +791,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for Rust version mismatch
-	regexRustVersion := regexp.MustCompile(`error: the current.*rustc .* is older than the minimum version required`)
 	if regexRustVersion.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because your Rust compiler (rustc) is too old for this project.\n\n"+
@@ -709,7 +800,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for permission issues with .cargo directory
-	regexCargoPermission := regexp.MustCompile(`failed to get metadata for.*: permission denied: .*\.cargo`)
 	if regexCargoPermission.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -731,7 +821,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for out of memory during Rust compilation
-	regexRustOOM := regexp.MustCompile(`(LLVM ERROR: out of memory|rustc.*internal compiler error.*out of memory|killed by the OOM killer)`)
 	if regexRustOOM.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because the system ran out of memory.\n\n"+
@@ -744,7 +833,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for target architecture issues
-	regexRustTarget := regexp.MustCompile(`error: failed to run custom build command for.*cross-compil|error: failed to run rustc to learn about target-specific information`)
 	if regexRustTarget.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed due to cross-compilation or target architecture issues.\n\n"+
@@ -758,7 +846,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// Check for user errors - these are errors that scripts deliberately output to diagnose issues
 
 	// Regular user error (reporting blocked)
-	regexUserError := regexp.MustCompile(`(?m)^User error: `)
 	if regexUserError.MatchString(errors) {
 		// Extract the error message - get only the lines that are part of the actual error
 		scanner := bufio.NewScanner(strings.NewReader(errors))
@@ -790,7 +877,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// User error with reporting allowed
-	regexUserErrorAllowed := regexp.MustCompile(`(?m)^User error \(reporting allowed\): `)
 	if regexUserErrorAllowed.MatchString(errors) {
 		// Extract the error message - get only the lines that are part of the actual error
 		scanner := bufio.NewScanner(strings.NewReader(errors))
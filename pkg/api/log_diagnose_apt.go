@@ -31,8 +31,268 @@ import (
 	"regexp"
 	"strconv"
 	"strings"
+	"sync"
 )
 
+// logDiagnosePatterns lists the literal substrings checked by LogDiagnose.
+// They are compiled into one Aho-Corasick automaton (lazily, once per
+// process) so each log is scanned a single time for all of them.
+var logDiagnosePatterns = []string{
+	"The following packages have unmet dependencies:",
+	"E:",
+	"error:",
+	"E: The repository",
+	"sources.list entry misspelt",
+	"component misspelt in",
+	"NO_PUBKEY",
+	" is no longer signed.",
+	"'APT reported these errors:",
+	"is configured multiple times in",
+	"W: Conflicting distribution: ",
+	"--fix-broken",
+	"needs to be reinstalled",
+	"dpkg --configure -a",
+	"not going to be installed",
+	"but it is not installable",
+	"has no installation candidate",
+	"is to be installed",
+	"Depends:",
+}
+
+// Regexes used by the log diagnosis checks. They are compiled together the
+// first time a log is diagnosed, so a batch of failed apps only pays the
+// compilation cost once per process.
+var (
+	logDiagnoseRegexOnce sync.Once
+
+	regexNotValid                     *regexp.Regexp
+	regexExpired                      *regexp.Regexp
+	regexTypo                         *regexp.Regexp
+	regexCorrupted                    *regexp.Regexp
+	regexBroken                       *regexp.Regexp
+	regexFixBroken                    *regexp.Regexp
+	regexForeignArch                  *regexp.Regexp
+	regexInconsistent                 *regexp.Regexp
+	regexEmpty                        *regexp.Regexp
+	regexLzma                         *regexp.Regexp
+	regexLock                         *regexp.Regexp
+	regexUpdates                      *regexp.Regexp
+	regexSuite                        *regexp.Regexp
+	regexMirror                       *regexp.Regexp
+	regexDefault                      *regexp.Regexp
+	regexRelease                      *regexp.Regexp
+	regexDkms                         *regexp.Regexp
+	regexDowngrade                    *regexp.Regexp
+	regexDowngradeList                *regexp.Regexp
+	regexBadMessage                   *regexp.Regexp
+	regexAnboxCompileFailure          *regexp.Regexp
+	regexXoneCompileFailure           *regexp.Regexp
+	regexPostInstall                  *regexp.Regexp
+	regexPostInvoke                   *regexp.Regexp
+	regexReinstallVulkan              *regexp.Regexp
+	regexDphysSwapfile                *regexp.Regexp
+	regexMissingFirmware              *regexp.Regexp
+	regexUbootRpi                     *regexp.Regexp
+	regexMissingFinalNewline          *regexp.Regexp
+	regexKernelPostInstall            *regexp.Regexp
+	regexBootloaderPostInstall        *regexp.Regexp
+	regexNginxFull                    *regexp.Regexp
+	regexLibWinePostInstall           *regexp.Regexp
+	regexFirmwareMicrobit             *regexp.Regexp
+	regexFlashKernel                  *regexp.Regexp
+	regexExagear                      *regexp.Regexp
+	regexCaCertificatesJava           *regexp.Regexp
+	regexMesaVulkan                   *regexp.Regexp
+	regexSteamLauncher                *regexp.Regexp
+	regexGnomeControlCenterData       *regexp.Regexp
+	regexPhp73Fpm                     *regexp.Regexp
+	regexNulog                        *regexp.Regexp
+	regexWpsOffice                    *regexp.Regexp
+	regexCmake                        *regexp.Regexp
+	regexBlockpi                      *regexp.Regexp
+	regexGstreamer10Dev               *regexp.Regexp
+	regexMonoCorlib45Dll              *regexp.Regexp
+	regexAndroidAndroresolvd          *regexp.Regexp
+	regexAndroidAndroresolvdArchive   *regexp.Regexp
+	regexDahdiDkms                    *regexp.Regexp
+	regexFreedm                       *regexp.Regexp
+	regexWsjtxIcon                    *regexp.Regexp
+	regexSystemd                      *regexp.Regexp
+	regexSdl2Image                    *regexp.Regexp
+	regexLibpagemaker                 *regexp.Regexp
+	regexTtfMscorefontsInstaller      *regexp.Regexp
+	regexGenericArm64LinuxKernelImage *regexp.Regexp
+	regexBrokenPackages               *regexp.Regexp
+	regexUnmetDeps                    *regexp.Regexp
+	regexDependencyConflict           *regexp.Regexp
+	regexInternetError                *regexp.Regexp
+	regexFetchPack                    *regexp.Regexp
+	regexFatalObject                  *regexp.Regexp
+	regexRemoteEndHungUp              *regexp.Regexp
+	regexCurlError                    *regexp.Regexp
+	regexAuthorizationFailed          *regexp.Regexp
+	regexFlathubError                 *regexp.Regexp
+	regexTlsError                     *regexp.Regexp
+	regexGnuTlsError                  *regexp.Regexp
+	regexConnectException             *regexp.Regexp
+	regexCrateNotFound                *regexp.Regexp
+	regexCargoNetwork                 *regexp.Regexp
+	regexHashDoesNotMatch             *regexp.Regexp
+	regexModuleNotFound               *regexp.Regexp
+	regexAppmenuGtkModule             *regexp.Regexp
+	regexGnupg                        *regexp.Regexp
+	regexDBus                         *regexp.Regexp
+	regexI18n                         *regexp.Regexp
+	regexSudoers                      *regexp.Regexp
+	regexIncorrectPassword            *regexp.Regexp
+	regexSudoHost                     *regexp.Regexp
+	regexSudoOperationNotPermitted    *regexp.Regexp
+	regexCpp                          *regexp.Regexp
+	regexTar                          *regexp.Regexp
+	regexXz                           *regexp.Regexp
+	regexAria2c                       *regexp.Regexp
+	regexPermissionDenied             *regexp.Regexp
+	regexReinstall                    *regexp.Regexp
+	regexLZ4FUnexpectedEOF            *regexp.Regexp
+	regexStructureNeedsCleaning       *regexp.Regexp
+	regexVCHI                         *regexp.Regexp
+	regexFlatpak                      *regexp.Regexp
+	regexSpace                        *regexp.Regexp
+	regexAutostart                    *regexp.Regexp
+	regexCache                        *regexp.Regexp
+	regexMkdir                        *regexp.Regexp
+	regexSegfault                     *regexp.Regexp
+	regexLsb                          *regexp.Regexp
+	regexKilled                       *regexp.Regexp
+	regexRustKilled                   *regexp.Regexp
+	regexSnapd                        *regexp.Regexp
+	regexVeraCrypt                    *regexp.Regexp
+	regexMount                        *regexp.Regexp
+	regexRustVersion                  *regexp.Regexp
+	regexCargoPermission              *regexp.Regexp
+	regexRustOOM                      *regexp.Regexp
+	regexRustTarget                   *regexp.Regexp
+	regexUserError                    *regexp.Regexp
+	regexUserErrorAllowed             *regexp.Regexp
+	regexArchExtract                  *regexp.Regexp
+)
+
+// compileLogDiagnoseRegexes compiles the diagnosis pattern table on first use
+func compileLogDiagnoseRegexes() {
+	logDiagnoseRegexOnce.Do(func() {
+		regexNotValid = regexp.MustCompile(`Release file for .* is not valid yet`)
+		regexExpired = regexp.MustCompile(`Release file for .* is expired`)
+		regexTypo = regexp.MustCompile(`sources.list entry misspelt`)
+		regexCorrupted = regexp.MustCompile(`E: The package cache file is corrupted`)
+		regexBroken = regexp.MustCompile(`E: Could not open file /var/lib/apt/lists/_tmp_pi-apps-local-packages_._Packages`)
+		regexFixBroken = regexp.MustCompile(`--fix-broken`)
+		regexForeignArch = regexp.MustCompile(`(404.*Not Found.*) (i386|amd64|armhf|arm64|riscv64) Packages|Ign:.*/(i386|amd64|armhf|arm64|riscv64) Packages`)
+		regexInconsistent = regexp.MustCompile(`package is in a very bad inconsistent state;`)
+		regexEmpty = regexp.MustCompile(`dpkg: error: fgets gave an empty string from`)
+		regexLzma = regexp.MustCompile(`lzma error: compressed data is corrupt`)
+		regexLock = regexp.MustCompile(`E: Could not get lock`)
+		regexUpdates = regexp.MustCompile(`dpkg: error: cannot scan updates directory`)
+		regexSuite = regexp.MustCompile(`E: Repository .* changed its 'Suite' value`)
+		regexMirror = regexp.MustCompile(`E: Failed to fetch .* File has unexpected size .* Mirror sync in progress\?`)
+		regexDefault = regexp.MustCompile(`E: The value 'stable' is invalid for APT::Default-Release as such a release is not available in the sources`)
+		regexRelease = regexp.MustCompile(`E: The value 'stable' is invalid for APT::Default-Release as such a release is not available in the sources`)
+		regexDkms = regexp.MustCompile(`dpkg: error processing package .*-dkms`)
+		regexDowngrade = regexp.MustCompile(`E: Packages were downgraded and -y was used without --allow-downgrades.`)
+		regexDowngradeList = regexp.MustCompile(`The following packages will be DOWNGRADED:`)
+		regexBadMessage = regexp.MustCompile(`unable to securely remove '.*': Bad message`)
+		regexAnboxCompileFailure = regexp.MustCompile(`Consult /var/lib/dkms/anbox-ashmem/1/build/make.log for more information.`)
+		regexXoneCompileFailure = regexp.MustCompile(`M=/var/lib/dkms/xone.*bad exit status`)
+		regexPostInstall = regexp.MustCompile(`installed .* post-installation script subprocess returned error exit status`)
+		regexPostInvoke = regexp.MustCompile(`E: Problem executing scripts DPkg::Post-Invoke '/home/.*/mesa_vulkan/reinstall-vulkan-driver.sh'`)
+		regexReinstallVulkan = regexp.MustCompile(`Reinstalling Vulkan driver`)
+		regexDphysSwapfile = regexp.MustCompile(`error processing package dphys-swapfile`)
+		regexMissingFirmware = regexp.MustCompile(`missing /boot/firmware, did you forget to mount it`)
+		regexUbootRpi = regexp.MustCompile(`u-boot-rpi`)
+		regexMissingFinalNewline = regexp.MustCompile(`files list file for package .* is missing final newline`)
+		regexKernelPostInstall = regexp.MustCompile(`raspberrypi-kernel package post-installation script subprocess returned error exit status`)
+		regexBootloaderPostInstall = regexp.MustCompile(`raspberrypi-bootloader package pre-installation script subprocess returned error exit status`)
+		regexNginxFull = regexp.MustCompile(`error processing package nginx-full`)
+		regexLibWinePostInstall = regexp.MustCompile(`libwine-development:arm64 package post-installation script subprocess returned error exit status`)
+		regexFirmwareMicrobit = regexp.MustCompile(`installed firmware-microbit-micropython-dl package post-installation script subprocess returned error exit status 1`)
+		regexFlashKernel = regexp.MustCompile(`installed flash-kernel package post-installation script subprocess returned error exit status 1`)
+		regexExagear = regexp.MustCompile(`Depends: exagear.* but it is not installable`)
+		regexCaCertificatesJava = regexp.MustCompile(`ca-certificates-java: Depends: ca-certificates-java (>= 20190405~) but it is not going to be installed`)
+		regexMesaVulkan = regexp.MustCompile(`E: Problem executing scripts DPkg::Post-Invoke '/home/.*/mesa_vulkan/reinstall-vulkan-driver.sh'`)
+		regexSteamLauncher = regexp.MustCompile(`dpkg: error processing archive .*steam-launcher`)
+		regexGnomeControlCenterData = regexp.MustCompile(`dpkg: error processing archive .*gnome-control-center-data`)
+		regexPhp73Fpm = regexp.MustCompile(`installed php7.3-fpm package post-installation script subprocess returned error exit status 1`)
+		regexNulog = regexp.MustCompile(`installed nulog package post-installation script subprocess returned error exit status 1`)
+		regexWpsOffice = regexp.MustCompile(`installed wps-office package post-installation script subprocess returned error exit status 127`)
+		regexCmake = regexp.MustCompile(`cmake but it is not installable`)
+		regexBlockpi = regexp.MustCompile(`blockpi : Depends: python3-picamera but it is not installable`)
+		regexGstreamer10Dev = regexp.MustCompile(`libgstreamer1.0-dev: Depends: libgstreamer1.0-dev-bin but it is not installable`)
+		regexMonoCorlib45Dll = regexp.MustCompile(`trying to overwrite '/usr/lib/mono/4.5/mscorlib.dll', which is also in package libmono-corlib4.5-dll`)
+		regexAndroidAndroresolvd = regexp.MustCompile(`installed android-androresolvd package post-installation script subprocess returned error exit status 1`)
+		regexAndroidAndroresolvdArchive = regexp.MustCompile(`dpkg: error processing archive .*android-androresolvd`)
+		regexDahdiDkms = regexp.MustCompile(`installed dahdi-dkms package post-installation script subprocess returned error exit status`)
+		regexFreedm = regexp.MustCompile(`freedm : Depends: prboom-plus but it is not going to be installed`)
+		regexWsjtxIcon = regexp.MustCompile(`trying to overwrite '/usr/share/pixmaps/wsjtx_icon.png', which is also in package wsjtx 2.6.1`)
+		regexSystemd = regexp.MustCompile(`installed systemd package post-installation script subprocess returned error exit status`)
+		regexSdl2Image = regexp.MustCompile(`trying to overwrite .*, which is also in package sdl2-image`)
+		regexLibpagemaker = regexp.MustCompile(`files list file for package 'libpagemaker-0.0-0:arm64' contains empty filename`)
+		regexTtfMscorefontsInstaller = regexp.MustCompile(`Package ttf-mscorefonts-installer is not available, but is referred to by another package.`)
+		regexGenericArm64LinuxKernelImage = regexp.MustCompile(`linux-image-.*-arm64`)
+		regexBrokenPackages = regexp.MustCompile(`E: Unable to correct problems, you have held broken packages.`)
+		regexUnmetDeps = regexp.MustCompile(`The following packages have unmet dependencies:`)
+		regexDependencyConflict = regexp.MustCompile(`error: failed to select a version for the requirement.*version conflict`)
+		regexInternetError = regexp.MustCompile(`Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out`)
+		regexFetchPack = regexp.MustCompile(`fetch-pack: unexpected disconnect while reading sideband packet`)
+		regexFatalObject = regexp.MustCompile(`fatal: did not receive expected object`)
+		regexRemoteEndHungUp = regexp.MustCompile(`fatal: the remote end hung up unexpectedly`)
+		regexCurlError = regexp.MustCompile(`curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)`)
+		regexAuthorizationFailed = regexp.MustCompile(`errorCode=24 Authorization failed.`)
+		regexFlathubError = regexp.MustCompile(`flathub: Error resolving .dl\.flathub\.org.`)
+		regexTlsError = regexp.MustCompile(`The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate`)
+		regexGnuTlsError = regexp.MustCompile(`GnuTLS recv error (-54): Error in the pull function.`)
+		regexConnectException = regexp.MustCompile(`errorCode=1 SSL/TLS handshake failure\|errorCode=1 total length mismatch.\|errorCode=1 Failed to establish connection, cause: Connection refused\|errorCode=1 Failed to connect to the host .*, cause: Network is unreachable\|Connecting to .* failed: Network is unreachable\|errorCode=2 Timeout\.\|abort: Connection reset by peer\|104: Connection reset by peer\|read: connection reset by peer\|errorCode=19.*Name resolution for.*failed\|failed: Temporary failure in name resolution.\|Unable to establish SSL connection.\|Connection closed at byte \|Read error at byte \|failed: No route to host\.\|errorCode=8 Invalid range header\.\|curl: .* transfer closed with .* bytes remaining to read\|errorCode=29 The response status is not successful\. status=503\|errorCode=22 The response status is not successful\. status=525\|Download snap .* from channel .* dial tcp: lookup api.snapcraft.io on .* read udp .* i/o timeout\|npm ERR\! code ERR_SOCKET_TIMEOUT\|dial tcp: lookup api.snapcraft.io on .*: no such host\|fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server\|RPC failed; curl .* transfer closed with outstanding read data remaining\|RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received.\|SSL error: .* - SSL - The peer notified us that the connection is going to be closed\|Failure when receiving data from the peer\|java\.net\.SocketTimeoutException: Read timed out\|Downloading .* failed, invalid checksum`)
+		regexCrateNotFound = regexp.MustCompile(`error: failed to get .*? as a dependency.*no matching package named`)
+		regexCargoNetwork = regexp.MustCompile(`error: failed to fetch from.*could not connect to server|error: failed to fetch.*Network is unreachable`)
+		regexHashDoesNotMatch = regexp.MustCompile(`ERROR: Downloaded system image hash doesn't match, expected`)
+		regexModuleNotFound = regexp.MustCompile(`modprobe: FATAL: Module .* not found in directory`)
+		regexAppmenuGtkModule = regexp.MustCompile(`Failed to load module "appmenu-gtk-module"`)
+		regexGnupg = regexp.MustCompile(`E: gnupg, gnupg2 and gnupg1 do not seem to be installed, but one of them is required for this operation`)
+		regexDBus = regexp.MustCompile(`error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down`)
+		regexI18n = regexp.MustCompile(`cat: /usr/share/i18n/SUPPORTED: No such file or directory`)
+		regexSudoers = regexp.MustCompile(`is not in the sudoers file.  This incident will be reported.`)
+		regexIncorrectPassword = regexp.MustCompile(`sudo: .* incorrect password attempts`)
+		regexSudoHost = regexp.MustCompile(`sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting`)
+		regexSudoOperationNotPermitted = regexp.MustCompile(`/usr/bin/sudo: Operation not permitted`)
+		regexCpp = regexp.MustCompile(`cpp.o: file not recognized: file truncated`)
+		regexTar = regexp.MustCompile(`tar: .* Wrote only .* of .* bytes\|tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;`)
+		regexXz = regexp.MustCompile(`xz: Cannot exec: No such file or directory`)
+		regexAria2c = regexp.MustCompile(`aria2c: error while loading shared libraries: /lib/arm-linux-gnueabihf/libaria2.so.0: unexpected reloc type 0xc8`)
+		regexPermissionDenied = regexp.MustCompile(`errorCode=16 Failed to open the file .*, cause: Permission denied`)
+		regexReinstall = regexp.MustCompile(`Reinstallation of .* is not possible, it cannot be downloaded\.`)
+		regexLZ4FUnexpectedEOF = regexp.MustCompile(`E: LZ4F: /var/lib/apt/lists/.*\.lz4 Unexpected end of file'`)
+		regexStructureNeedsCleaning = regexp.MustCompile(`Structure needs cleaning`)
+		regexVCHI = regexp.MustCompile(`VCHI initialization failed`)
+		regexFlatpak = regexp.MustCompile(`Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object`)
+		regexSpace = regexp.MustCompile(`You don't have enough free space in\|No space left on device\|Not enough disk space to complete this operation\|Out of diskspace\|Cannot write to .* (Success)\.\|Delta requires .* GB free space, but only .* available\|err:setupapi:install_fake_dll failed to write to .* (error=0)\|fatal: sha1 file '.*' write error\. Out of diskspace`)
+		regexAutostart = regexp.MustCompile(`: line .*: \$HOME/\.config/autostart/.*\.desktop: Permission denied`)
+		regexCache = regexp.MustCompile(`The directory '(\$HOME|\$\{HOME\}|/home/[^/]+)/\.cache/pip' or its parent directory is not owned by the current user`)
+		regexMkdir = regexp.MustCompile(`mkdir: cannot create directory .*/home/[^/]+/pi-apps-.*: Permission denied|rm: cannot remove .*/home/[^/]+/.*: Permission denied`)
+		regexSegfault = regexp.MustCompile(`collect2: fatal error: ld terminated with signal 11 \[Segmentation fault\]`)
+		regexLsb = regexp.MustCompile(`ModuleNotFoundError: No module named 'lsb_release'`)
+		regexKilled = regexp.MustCompile(`c\+\+: fatal error: Killed signal terminated program cc1plus`)
+		regexRustKilled = regexp.MustCompile(`process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)`)
+		regexSnapd = regexp.MustCompile(`error: system does not fully support snapd: cannot mount squashfs image`)
+		regexVeraCrypt = regexp.MustCompile(`Error: All VeraCrypt volumes must be dismounted first.`)
+		regexMount = regexp.MustCompile(`Failed to mount squashfs image`)
+		regexRustVersion = regexp.MustCompile(`error: the current.*rustc .* is older than the minimum version required`)
+		regexCargoPermission = regexp.MustCompile(`failed to get metadata for.*: permission denied: .*\.cargo`)
+		regexRustOOM = regexp.MustCompile(`(LLVM ERROR: out of memory|rustc.*internal compiler error.*out of memory|killed by the OOM killer)`)
+		regexRustTarget = regexp.MustCompile(`error: failed to run custom build command for.*cross-compil|error: failed to run rustc to learn about target-specific information`)
+		regexUserError = regexp.MustCompile(`(?m)^User error: `)
+		regexUserErrorAllowed = regexp.MustCompile(`(?m)^User error \(reporting allowed\): `)
+		regexArchExtract = regexp.MustCompile(`(?:404.*Not Found.*|Ign:.*/) (i386|amd64|armhf|arm64|riscv64) Packages`)
+	})
+}
+
 // LogDiagnose analyzes a logfile and returns diagnostic information
 //
 // It takes a logfile path and an allowWrite parameter
@@ -40,6 +300,8 @@ import (
 //	ErrorDiagnosis - the error diagnosis
 //	error - error if logfile is not specified
 func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
+	compileLogDiagnoseRegexes()
+
 	// Read the logfile
 	content, err := os.ReadFile(logfilePath)
 	if err != nil {
@@ -48,6 +310,9 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 
 	errors := string(content)
 
+	// Match every literal error pattern in a single pass over the log
+	logMatches := scanLogPatterns(errors, logDiagnosePatterns)
+
 	// Determine the actual log file path to write to - used when implementing write functionality
 	// Currently not used in this implementation
 	_ = logfilePath
@@ -121,9 +386,9 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	if (osID == "Debian" || osID == "Raspbian") && versionNum >= 13 {
 		// Only show Trixie message if we have unmet dependencies or other errors
 		// This prevents showing the message on successful installs
-		if strings.Contains(errors, "The following packages have unmet dependencies:") ||
-			strings.Contains(errors, "E:") ||
-			strings.Contains(errors, "error:") {
+		if logMatches.contains("The following packages have unmet dependencies:") ||
+			logMatches.contains("E:") ||
+			logMatches.contains("error:") {
 			diagnosis.Captions = append(diagnosis.Captions,
 				"All the Pi-Apps Go apps are not yet supported in Trixie.\n\n"+
 					"We are tracking all apps that fail to install on PiOS Trixie from upstream issue https://github.com/Botspot/pi-apps/issues/2829\n"+
@@ -142,9 +407,9 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	//------------------------------------------
 
 	// Check for 'E: The repository'
-	if strings.Contains(errors, "E: The repository") ||
-		strings.Contains(errors, "sources.list entry misspelt") ||
-		strings.Contains(errors, "component misspelt in") {
+	if logMatches.contains("E: The repository") ||
+		logMatches.contains("sources.list entry misspelt") ||
+		logMatches.contains("component misspelt in") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a faulty repository, and you must fix it before Pi-Apps will work.\n\n"+
 				"To delete the repository:\n"+
@@ -155,8 +420,8 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for 'NO_PUBKEY' or ' is no longer signed.'
-	if strings.Contains(errors, "NO_PUBKEY") ||
-		strings.Contains(errors, " is no longer signed.") {
+	if logMatches.contains("NO_PUBKEY") ||
+		logMatches.contains(" is no longer signed.") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported an unsigned repository. This has to be solved before APT or Pi-Apps, will work.\n\n"+
 				"If you're not sure what to do, you can try to fix the problem by running this command in a terminal:\n"+
@@ -165,7 +430,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for 'Could not resolve' or 'Failed to fetch' if it was caused by APT
-	if strings.Contains(errors, "'APT reported these errors:") &&
+	if logMatches.contains("'APT reported these errors:") &&
 		containsAny(errors, []string{
 			"Could not resolve",
 			"Failed to fetch",
@@ -179,7 +444,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for 'is configured multiple times in'
-	if strings.Contains(errors, "is configured multiple times in") {
+	if logMatches.contains("is configured multiple times in") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a double-configured repository, and you must fix it to fix Pi-Apps.\n\n"+
 				"To delete the repository:\n"+
@@ -190,7 +455,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "W: Conflicting distribution: "
-	if strings.Contains(errors, "W: Conflicting distribution: ") {
+	if logMatches.contains("W: Conflicting distribution: ") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a conflicting repository.\n\n"+
 				"Read the installation errors, then look through /etc/apt/sources.list and /etc/apt/sources.list.d, making changes as necessary.\n\n"+
@@ -199,7 +464,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "Release file for <repo-url> is not valid yet"
-	regexNotValid := regexp.MustCompile(`Release file for .* is not valid yet`)
 	if regexNotValid.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a repository whose release file becomes valid in the future.\n\n"+
@@ -208,7 +472,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "Release file for <repo-url> is expired"
-	regexExpired := regexp.MustCompile(`Release file for .* is expired`)
 	if regexExpired.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a repository whose release file was invalidated in the past.\n"+
@@ -219,7 +482,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 		diagnosis.ErrorType = "system"
 	}
 	// check for typo in sources.list and list.d
-	regexTypo := regexp.MustCompile(`sources.list entry misspelt`)
 	if regexTypo.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a typo in the sources.list file.\n"+
@@ -227,7 +489,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 		diagnosis.ErrorType = "system"
 	}
 	// check for "E: The package cache file is corrupted"
-	regexCorrupted := regexp.MustCompile(`E: The package cache file is corrupted`)
 	if regexCorrupted.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT found something wrong with a package list file.\n"+
@@ -235,7 +496,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 		diagnosis.ErrorType = "system"
 	}
 	// check for broken pi-apps-local-packages symlink
-	regexBroken := regexp.MustCompile(`E: Could not open file /var/lib/apt/lists/_tmp_pi-apps-local-packages_._Packages`)
 	if regexBroken.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported the pi-apps-local-packages list as missing.\n"+
@@ -247,7 +507,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	//------------------------------------------
 
 	// check for "--fix-broken"
-	regexFixBroken := regexp.MustCompile(`--fix-broken`)
 	if regexFixBroken.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a broken package.\n\n"+
@@ -256,15 +515,15 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for apt/dpkg issues
-	if strings.Contains(errors, "--fix-broken") ||
-		strings.Contains(errors, "needs to be reinstalled") {
+	if logMatches.contains("--fix-broken") ||
+		logMatches.contains("needs to be reinstalled") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a broken package.\n\n"+
 				"Please run this command: sudo apt --fix-broken install")
 		diagnosis.ErrorType = "package"
 	}
 	// Check for "dpkg --configure -a"
-	if strings.Contains(errors, "dpkg --configure -a") {
+	if logMatches.contains("dpkg --configure -a") {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Before dpkg, apt, or Pi-Apps will work, dpkg needs to repair your system.\n\n"+
 				"Please run this command: sudo dpkg --configure -a")
@@ -272,7 +531,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for unsupported foreign architectures
-	regexForeignArch := regexp.MustCompile(`(404.*Not Found.*) (i386|amd64|armhf|arm64|riscv64) Packages|Ign:.*/(i386|amd64|armhf|arm64|riscv64) Packages`)
 	if regexForeignArch.MatchString(errors) {
 		// Get current system architecture
 		currentArch, err := getCurrentSystemArchitecture()
@@ -302,7 +560,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "package is in a very bad inconsistent state;"
-	regexInconsistent := regexp.MustCompile(`package is in a very bad inconsistent state;`)
 	if regexInconsistent.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with another package on your system.\n\n"+
@@ -311,7 +568,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "dpkg: error: fgets gave an empty string from"
-	regexEmpty := regexp.MustCompile(`dpkg: error: fgets gave an empty string from`)
 	if regexEmpty.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something strange is going on with your system and dpkg won't work.\n\n"+
@@ -320,7 +576,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "lzma error: compressed data is corrupt"
-	regexLzma := regexp.MustCompile(`lzma error: compressed data is corrupt`)
 	if regexLzma.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"A package failed to install because it appears corrupted. (buggy download?)")
@@ -328,7 +583,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "E: Could not get lock"
-	regexLock := regexp.MustCompile(`E: Could not get lock`)
 	if regexLock.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Some other apt-get/dpkg process is running. Wait for that one to finish, then try again.")
@@ -336,7 +590,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "dpkg: error: cannot scan updates directory"
-	regexUpdates := regexp.MustCompile(`dpkg: error: cannot scan updates directory`)
 	if regexUpdates.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"What did you do to your system? The '/var/lib/dpkg/updates' folder is missing. \n\n"+
@@ -346,7 +599,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "E: Repository .* changed its 'Suite' value"
-	regexSuite := regexp.MustCompile(`E: Repository .* changed its 'Suite' value`)
 	if regexSuite.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"One or more APT repositories on your system have changed Suite values. Usually this occurs when a new version of Debian is released every two years. \n\n"+
@@ -356,7 +608,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "E: Failed to fetch .* File has unexpected size .* Mirror sync in progress\?"
-	regexMirror := regexp.MustCompile(`E: Failed to fetch .* File has unexpected size .* Mirror sync in progress\?`)
 	if regexMirror.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT encountered a repository with a file that is of incorrect size. This can be caused by a periodic mirror sync, or maybe the repository is faulty. \n\n"+
@@ -365,7 +616,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "E: The value 'stable' is invalid for APT::Default-Release as such a release is not available in the sources"
-	regexDefault := regexp.MustCompile(`E: The value 'stable' is invalid for APT::Default-Release as such a release is not available in the sources`)
 	if regexDefault.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT encountered an issue reading a source file for a repository. Most likely, you were trying to change your sources and did not format the file correctly. \n\n"+
@@ -373,7 +623,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 		diagnosis.ErrorType = "system"
 	}
 	// check for "E: The value 'stable' is invalid for APT::Default-Release as such a release is not available in the sources"
-	regexRelease := regexp.MustCompile(`E: The value 'stable' is invalid for APT::Default-Release as such a release is not available in the sources`)
 	if regexRelease.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT encountered an issue reading a source file for a repository. Most likely, you were trying to change your sources and did not format the file correctly. \n\n"+
@@ -382,7 +631,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "dpkg: error processing package .*-dkms"
-	regexDkms := regexp.MustCompile(`dpkg: error processing package .*-dkms`)
 	if regexDkms.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"A DKMS (Dynamic Kernel Module Support) package failed to install and has prevented apt from working correctly. This is likely an issue with your distribution and you should report it wherever applicable. \n\n"+
@@ -391,7 +639,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "The following packages have unmet dependencies:"
-	if strings.Contains(errors, "The following packages have unmet dependencies:") {
+	if logMatches.contains("The following packages have unmet dependencies:") {
 		// If allowWrite is true, we need to write additional diagnostic information to the logfile
 		if allowWrite {
 			// Open the logfile for appending
@@ -706,7 +954,7 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 				}
 
 				// If we've processed all cases but still have no specific diagnosis, add a generic unmet dependencies message
-				if diagnosis.ErrorType == "" && strings.Contains(errors, "The following packages have unmet dependencies:") {
+				if diagnosis.ErrorType == "" && logMatches.contains("The following packages have unmet dependencies:") {
 					// Extract the whole section about unmet dependencies
 					unmetSection := ""
 					scanner = bufio.NewScanner(strings.NewReader(errors))
@@ -730,27 +978,27 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 					}
 
 					// Add appropriate generic messages
-					if strings.Contains(errors, "not going to be installed") {
+					if logMatches.contains("not going to be installed") {
 						diagnosis.Captions = append(diagnosis.Captions,
 							"Packages failed to install because the package manager requires you to install some dependencies manually.\n\n"+
 								unmetSection+"\n"+
 								"Either your APT repositories are broken, or you need to run:\n"+
 								"sudo apt update && sudo apt full-upgrade")
 						diagnosis.ErrorType = "system"
-					} else if strings.Contains(errors, "but it is not installable") {
+					} else if logMatches.contains("but it is not installable") {
 						diagnosis.Captions = append(diagnosis.Captions,
 							"Packages failed to install because at least one dependency is not available in your repositories:\n\n"+
 								unmetSection+"\n"+
 								"This might be fixed by enabling additional repositories or by running:\n"+
 								"sudo apt update && sudo apt full-upgrade")
 						diagnosis.ErrorType = "system"
-					} else if strings.Contains(errors, "has no installation candidate") {
+					} else if logMatches.contains("has no installation candidate") {
 						diagnosis.Captions = append(diagnosis.Captions,
 							"Packages failed to install because one or more packages are not available in your repositories:\n\n"+
 								unmetSection+"\n"+
 								"This might be fixed by enabling additional repositories.")
 						diagnosis.ErrorType = "system"
-					} else if strings.Contains(errors, "is to be installed") || strings.Contains(errors, "Depends:") {
+					} else if logMatches.contains("is to be installed") || logMatches.contains("Depends:") {
 						diagnosis.Captions = append(diagnosis.Captions,
 							"Packages failed to install due to unmet dependencies:\n\n"+
 								unmetSection+"\n"+
@@ -895,8 +1143,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Downgrade errors with no actual packages listed as to be downgraded. Assume users (custom) distro is to blame
-	regexDowngrade := regexp.MustCompile(`E: Packages were downgraded and -y was used without --allow-downgrades.`)
-	regexDowngradeList := regexp.MustCompile(`The following packages will be DOWNGRADED:`)
 	if regexDowngrade.MatchString(errors) && !regexDowngradeList.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Apt is reporting conflicting information that packages would be downgraded as a result of this standard apt install yet no packages are listed as to be downgraded. This is likely an issue with your linux distribution. Please contact the appropriate maintainer for assistance.")
@@ -1014,7 +1260,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "unable to securely remove '.*': Bad message"
-	regexBadMessage := regexp.MustCompile(`unable to securely remove '.*': Bad message`)
 	if regexBadMessage.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Got a 'Bad message' error when trying to remove a file in an unrelated package. This is not a Pi-Apps issue, but it may indicate hardware failure or disk corruption on your computer.\n\n"+
@@ -1029,7 +1274,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	//------------------------------------------
 
 	// check for "Consult /var/lib/dkms/anbox-ashmem/1/build/make.log for more information."
-	regexAnboxCompileFailure := regexp.MustCompile(`Consult /var/lib/dkms/anbox-ashmem/1/build/make.log for more information.`)
 	if regexAnboxCompileFailure.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Anbox kernel modules no longer compile on the latest kernel. You need to remove it for the kernel to fully install and for APT to work.\n"+
@@ -1039,7 +1283,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "M=/var/lib/dkms/xone.*bad exit status"
-	regexXoneCompileFailure := regexp.MustCompile(`M=/var/lib/dkms/xone.*bad exit status`)
 	if regexXoneCompileFailure.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The Xone kernel module no longer compile on the latest kernel. You need to remove it for the kernel to fully install and for APT to work.\n"+
@@ -1049,7 +1292,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed .* post-installation script subprocess returned error exit status"
-	regexPostInstall := regexp.MustCompile(`installed .* post-installation script subprocess returned error exit status`)
 	if regexPostInstall.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"A package failed to install because it encountered an error during the post-installation script.")
@@ -1057,7 +1299,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "E: Problem executing scripts DPkg::Post-Invoke '/home/.*/mesa_vulkan/reinstall-vulkan-driver.sh'"
-	regexPostInvoke := regexp.MustCompile(`E: Problem executing scripts DPkg::Post-Invoke '/home/.*/mesa_vulkan/reinstall-vulkan-driver.sh'`)
 	if regexPostInvoke.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"PiKiss has installed a broken custom vulkan reinstallation apt hook. As a result, dpkg and APT won't work properly.")
@@ -1065,7 +1306,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Reinstalling Vulkan driver"
-	regexReinstallVulkan := regexp.MustCompile(`Reinstalling Vulkan driver`)
 	if regexReinstallVulkan.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"PiKiss has installed a broken custom vulkan reinstallation apt hook. As a result, dpkg and APT won't work properly.")
@@ -1073,7 +1313,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "error processing package dphys-swapfile"
-	regexDphysSwapfile := regexp.MustCompile(`error processing package dphys-swapfile`)
 	if regexDphysSwapfile.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Before dpkg, apt, or Pi-Apps will work, dphys-swapfile must be fixed. \n\n"+
@@ -1082,8 +1321,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "missing /boot/firmware, did you forget to mount it" or "u-boot-rpi"
-	regexMissingFirmware := regexp.MustCompile(`missing /boot/firmware, did you forget to mount it`)
-	regexUbootRpi := regexp.MustCompile(`u-boot-rpi`)
 	if regexMissingFirmware.MatchString(errors) || regexUbootRpi.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Package(s) failed to install because your boot drive is not working. \n\n"+
@@ -1092,7 +1329,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "files list file for package .* is missing final newline"
-	regexMissingFinalNewline := regexp.MustCompile(`files list file for package .* is missing final newline`)
 	if regexMissingFinalNewline.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Before dpkg, apt, or Pi-Apps will work, your system must be repaired. \n\n"+
@@ -1101,7 +1337,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "raspberrypi-kernel package post-installation script subprocess returned error exit status"
-	regexKernelPostInstall := regexp.MustCompile(`raspberrypi-kernel package post-installation script subprocess returned error exit status`)
 	if regexKernelPostInstall.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The raspberrypi-kernel package on your system is causing problems. \n\n"+
@@ -1111,7 +1346,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "raspberrypi-bootloader package pre-installation script subprocess returned error exit status"
-	regexBootloaderPostInstall := regexp.MustCompile(`raspberrypi-bootloader package pre-installation script subprocess returned error exit status`)
 	if regexBootloaderPostInstall.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The raspberrypi-bootloader package on your system is causing problems. \n\n"+
@@ -1121,7 +1355,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "error processing package nginx-full"
-	regexNginxFull := regexp.MustCompile(`error processing package nginx-full`)
 	if regexNginxFull.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The nginx-full package on your system encountered a problem. \n\n"+
@@ -1130,7 +1363,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "libwine-development:arm64 package post-installation script subprocess returned error exit status"
-	regexLibWinePostInstall := regexp.MustCompile(`libwine-development:arm64 package post-installation script subprocess returned error exit status`)
 	if regexLibWinePostInstall.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The libwine-development package on your system encountered a problem. \n\n"+
@@ -1139,7 +1371,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed firmware-microbit-micropython-dl package post-installation script subprocess returned error exit status 1"
-	regexFirmwareMicrobit := regexp.MustCompile(`installed firmware-microbit-micropython-dl package post-installation script subprocess returned error exit status 1`)
 	if regexFirmwareMicrobit.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The firmware-microbit-micropython-dl package on your system encountered a problem. \n\n"+
@@ -1148,7 +1379,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed flash-kernel package post-installation script subprocess returned error exit status 1"
-	regexFlashKernel := regexp.MustCompile(`installed flash-kernel package post-installation script subprocess returned error exit status 1`)
 	if regexFlashKernel.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The flash-kernel package on your system encountered a problem. \n\n"+
@@ -1157,7 +1387,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Depends: exagear.* but it is not installable"
-	regexExagear := regexp.MustCompile(`Depends: exagear.* but it is not installable`)
 	if regexExagear.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The exagear package on your system is causing problems. \n\n"+
@@ -1166,7 +1395,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "ca-certificates-java: Depends: ca-certificates-java (>= 20190405~) but it is not going to be installed"
-	regexCaCertificatesJava := regexp.MustCompile(`ca-certificates-java: Depends: ca-certificates-java (>= 20190405~) but it is not going to be installed`)
 	if regexCaCertificatesJava.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The ca-certificates-java package on your system is causing problems. \n\n"+
@@ -1175,7 +1403,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "E: Problem executing scripts DPkg::Post-Invoke '/home/.*/mesa_vulkan/reinstall-vulkan-driver.sh'"
-	regexMesaVulkan := regexp.MustCompile(`E: Problem executing scripts DPkg::Post-Invoke '/home/.*/mesa_vulkan/reinstall-vulkan-driver.sh'`)
 	if regexMesaVulkan.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The mesa_vulkan package on your system is causing problems. \n\n"+
@@ -1184,7 +1411,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "dpkg: error processing archive .*steam-launcher"
-	regexSteamLauncher := regexp.MustCompile(`dpkg: error processing archive .*steam-launcher`)
 	if regexSteamLauncher.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The steam-launcher package on your system is causing problems. \n\n"+
@@ -1193,7 +1419,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "dpkg: error processing archive .*gnome-control-center-data"
-	regexGnomeControlCenterData := regexp.MustCompile(`dpkg: error processing archive .*gnome-control-center-data`)
 	if regexGnomeControlCenterData.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The gnome-control-center-data package on your system is causing problems. \n\n"+
@@ -1202,7 +1427,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed php7.3-fpm package post-installation script subprocess returned error exit status 1"
-	regexPhp73Fpm := regexp.MustCompile(`installed php7.3-fpm package post-installation script subprocess returned error exit status 1`)
 	if regexPhp73Fpm.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The php7.3-fpm package on your system is causing problems. \n\n"+
@@ -1211,7 +1435,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed nulog package post-installation script subprocess returned error exit status 1"
-	regexNulog := regexp.MustCompile(`installed nulog package post-installation script subprocess returned error exit status 1`)
 	if regexNulog.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The nulog package on your system is causing problems. \n\n"+
@@ -1220,7 +1443,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed wps-office package post-installation script subprocess returned error exit status 127"
-	regexWpsOffice := regexp.MustCompile(`installed wps-office package post-installation script subprocess returned error exit status 127`)
 	if regexWpsOffice.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The wps-office package on your system is causing problems. \n\n"+
@@ -1229,7 +1451,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "cmake but it is not installable"
-	regexCmake := regexp.MustCompile(`cmake but it is not installable`)
 	if regexCmake.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The cmake package on your system is causing problems. \n\n"+
@@ -1238,7 +1459,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "blockpi : Depends: python3-picamera but it is not installable"
-	regexBlockpi := regexp.MustCompile(`blockpi : Depends: python3-picamera but it is not installable`)
 	if regexBlockpi.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"BlockPi could not be installed because the python3-picamera package is missing. \n\n"+
@@ -1247,7 +1467,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "libgstreamer1.0-dev: Depends: libgstreamer1.0-dev-bin but it is not installable"
-	regexGstreamer10Dev := regexp.MustCompile(`libgstreamer1.0-dev: Depends: libgstreamer1.0-dev-bin but it is not installable`)
 	if regexGstreamer10Dev.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The libgstreamer1.0-dev package on your system is causing problems. \n\n"+
@@ -1256,7 +1475,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "trying to overwrite '/usr/lib/mono/4.5/mscorlib.dll', which is also in package libmono-corlib4.5-dll"
-	regexMonoCorlib45Dll := regexp.MustCompile(`trying to overwrite '/usr/lib/mono/4.5/mscorlib.dll', which is also in package libmono-corlib4.5-dll`)
 	if regexMonoCorlib45Dll.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The libmono-corlib4.5-dll package on your system is causing problems. \n\n"+
@@ -1265,7 +1483,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed android-androresolvd package post-installation script subprocess returned error exit status 1"
-	regexAndroidAndroresolvd := regexp.MustCompile(`installed android-androresolvd package post-installation script subprocess returned error exit status 1`)
 	if regexAndroidAndroresolvd.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The android-androresolvd package on your system is causing problems. \n\n"+
@@ -1274,7 +1491,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "dpkg: error processing archive .*android-androresolvd"
-	regexAndroidAndroresolvdArchive := regexp.MustCompile(`dpkg: error processing archive .*android-androresolvd`)
 	if regexAndroidAndroresolvdArchive.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The android-androresolvd package on your system is causing problems. \n\n"+
@@ -1283,7 +1499,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed dahdi-dkms package post-installation script subprocess returned error exit status"
-	regexDahdiDkms := regexp.MustCompile(`installed dahdi-dkms package post-installation script subprocess returned error exit status`)
 	if regexDahdiDkms.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The dahdi-dkms package on your system is causing problems. \n\n"+
@@ -1292,7 +1507,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "freedm : Depends: prboom-plus but it is not going to be installed"
-	regexFreedm := regexp.MustCompile(`freedm : Depends: prboom-plus but it is not going to be installed`)
 	if regexFreedm.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The freedm package on your system is causing problems. \n\n"+
@@ -1301,7 +1515,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "trying to overwrite '/usr/share/pixmaps/wsjtx_icon.png', which is also in package wsjtx 2.6.1"
-	regexWsjtxIcon := regexp.MustCompile(`trying to overwrite '/usr/share/pixmaps/wsjtx_icon.png', which is also in package wsjtx 2.6.1`)
 	if regexWsjtxIcon.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The wsjtx-data package is conflicting with the wsjtx package installed on your system. You must fix this to install additional software.\n\n"+
@@ -1312,7 +1525,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "installed systemd package post-installation script subprocess returned error exit status"
-	regexSystemd := regexp.MustCompile(`installed systemd package post-installation script subprocess returned error exit status`)
 	if regexSystemd.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"What did you do to your system? The \"systemd\" package is not installing correctly. \n\n"+
@@ -1321,7 +1533,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "trying to overwrite .*, which is also in package sdl2-image"
-	regexSdl2Image := regexp.MustCompile(`trying to overwrite .*, which is also in package sdl2-image`)
 	if regexSdl2Image.MatchString(errors) {
 		// Try to automatically remove the problematic packages
 		_, err1 := runCommand("sudo", "apt-get", "-y", "purge", "sdl2-image")
@@ -1347,7 +1558,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "files list file for package 'libpagemaker-0.0-0:arm64' contains empty filename"
-	regexLibpagemaker := regexp.MustCompile(`files list file for package 'libpagemaker-0.0-0:arm64' contains empty filename`)
 	if regexLibpagemaker.MatchString(errors) {
 		// Try to remove the problematic package
 		cmd := exec.Command("sudo", "apt-get", "purge", "libpagemaker-0.0-")
@@ -1368,7 +1578,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Package ttf-mscorefonts-installer is not available, but is referred to by another package."
-	regexTtfMscorefontsInstaller := regexp.MustCompile(`Package ttf-mscorefonts-installer is not available, but is referred to by another package.`)
 	if regexTtfMscorefontsInstaller.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The ttf-mscorefonts-installer package is not available, causing this app to fail to install. You must fix this to install additional software.\n\n"+
@@ -1378,7 +1587,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for generic ARM64 linux kernel image on Raspberry Pi OS
-	regexGenericArm64LinuxKernelImage := regexp.MustCompile(`linux-image-.*-arm64`)
 	if regexGenericArm64LinuxKernelImage.MatchString(errors) {
 		// Check if running on Raspberry Pi OS by checking for /etc/rpi-issue
 		_, err := os.Stat("/etc/rpi-issue")
@@ -1402,8 +1610,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for backports conflicts on Debian/Raspbian
-	regexBrokenPackages := regexp.MustCompile(`E: Unable to correct problems, you have held broken packages.`)
-	regexUnmetDeps := regexp.MustCompile(`The following packages have unmet dependencies:`)
 
 	if regexBrokenPackages.MatchString(errors) && regexUnmetDeps.MatchString(errors) {
 		// Get OS information
@@ -1437,7 +1643,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// cargo package errors below
 
 	// Check for incompatible dependencies
-	regexDependencyConflict := regexp.MustCompile(`error: failed to select a version for the requirement.*version conflict`)
 	if regexDependencyConflict.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed due to conflicting dependency requirements.\n\n"+
@@ -1449,7 +1654,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// internet errors below
 
 	// check for "Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out" aka internet errors
-	regexInternetError := regexp.MustCompile(`Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out`)
 	if regexInternetError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to connect to github.com.\n\n"+
@@ -1458,7 +1662,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fetch-pack: unexpected disconnect while reading sideband packet" aka git errors
-	regexFetchPack := regexp.MustCompile(`fetch-pack: unexpected disconnect while reading sideband packet`)
 	if regexFetchPack.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fetch-pack: unexpected disconnect while reading sideband packet\" Check the stability of your Internet connection and try again. \n\n"+
@@ -1467,7 +1670,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fatal: did not receive expected object" aka git errors
-	regexFatalObject := regexp.MustCompile(`fatal: did not receive expected object`)
 	if regexFatalObject.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fatal: did not receive expected object\" Check the stability of your Internet connection and try again.\n\n"+
@@ -1476,7 +1678,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fatal: the remote end hung up unexpectedly" aka git errors
-	regexRemoteEndHungUp := regexp.MustCompile(`fatal: the remote end hung up unexpectedly`)
 	if regexRemoteEndHungUp.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fatal: the remote end hung up unexpectedly\" Check the stability of your Internet connection and try again.\n\n"+
@@ -1485,7 +1686,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)"
-	regexCurlError := regexp.MustCompile(`curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)`)
 	if regexCurlError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed due to an internal curl error. This could be an internet issue or hardware problem. \n"+
@@ -1494,7 +1694,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "errorCode=24 Authorization failed."
-	regexAuthorizationFailed := regexp.MustCompile(`errorCode=24 Authorization failed.`)
 	if regexAuthorizationFailed.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The curl command encountered this error: \"errorCode=24 Authorization failed.\" Check the stability of your Internet connection and try again.")
@@ -1502,7 +1701,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "flathub: Error resolving .dl\.flathub\.org."
-	regexFlathubError := regexp.MustCompile(`flathub: Error resolving .dl\.flathub\.org.`)
 	if regexFlathubError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The flathub command encountered this error: \"flathub: Error resolving .dl.flathub.org.\" Check the stability of your Internet connection and try again.")
@@ -1510,7 +1708,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate"
-	regexTlsError := regexp.MustCompile(`The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate`)
 	if regexTlsError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The TLS connection was non-properly terminated. Check the stability of your Internet connection and try again.")
@@ -1518,7 +1715,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "GnuTLS recv error (-54): Error in the pull function."
-	regexGnuTlsError := regexp.MustCompile(`GnuTLS recv error (-54): Error in the pull function.`)
 	if regexGnuTlsError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed due to an issue with your internet, not Pi-Apps. The connection was terminated before the download completed. \n\n"+
@@ -1537,7 +1733,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for miscellaneous internet errors
-	regexConnectException := regexp.MustCompile(`errorCode=1 SSL/TLS handshake failure\|errorCode=1 total length mismatch.\|errorCode=1 Failed to establish connection, cause: Connection refused\|errorCode=1 Failed to connect to the host .*, cause: Network is unreachable\|Connecting to .* failed: Network is unreachable\|errorCode=2 Timeout\.\|abort: Connection reset by peer\|104: Connection reset by peer\|read: connection reset by peer\|errorCode=19.*Name resolution for.*failed\|failed: Temporary failure in name resolution.\|Unable to establish SSL connection.\|Connection closed at byte \|Read error at byte \|failed: No route to host\.\|errorCode=8 Invalid range header\.\|curl: .* transfer closed with .* bytes remaining to read\|errorCode=29 The response status is not successful\. status=503\|errorCode=22 The response status is not successful\. status=525\|Download snap .* from channel .* dial tcp: lookup api.snapcraft.io on .* read udp .* i/o timeout\|npm ERR\! code ERR_SOCKET_TIMEOUT\|dial tcp: lookup api.snapcraft.io on .*: no such host\|fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server\|RPC failed; curl .* transfer closed with outstanding read data remaining\|RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received.\|SSL error: .* - SSL - The peer notified us that the connection is going to be closed\|Failure when receiving data from the peer\|java\.net\.SocketTimeoutException: Read timed out\|Downloading .* failed, invalid checksum`)
 	if regexConnectException.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed. Check your internet connection and firewall, then try again.")
@@ -1545,7 +1740,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cargo crate not found error
-	regexCrateNotFound := regexp.MustCompile(`error: failed to get .*? as a dependency.*no matching package named`)
 	if regexCrateNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because a required crate dependency was not found.\n\n"+
@@ -1558,7 +1752,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cargo network errors
-	regexCargoNetwork := regexp.MustCompile(`error: failed to fetch from.*could not connect to server|error: failed to fetch.*Network is unreachable`)
 	if regexCargoNetwork.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Cargo couldn't connect to the crates.io registry or other dependency sources.\n\n"+
@@ -1567,7 +1760,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for ERROR: Downloaded system image hash doesn't match, expected <hash> from Waydroid
-	regexHashDoesNotMatch := regexp.MustCompile(`ERROR: Downloaded system image hash doesn't match, expected`)
 	if regexHashDoesNotMatch.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Waydroid OS image download failed. Check your internet connection and firewall, then try again.")
@@ -1585,7 +1777,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// other system errors below
 
 	// check for modprobe: FATAL: Module .* not found in directory
-	regexModuleNotFound := regexp.MustCompile(`modprobe: FATAL: Module .* not found in directory`)
 	if regexModuleNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with the kernel modules. Try rebooting if your kernel was upgraded. \n\n"+
@@ -1596,7 +1787,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Failed to load module \"appmenu-gtk-module\""
-	regexAppmenuGtkModule := regexp.MustCompile(`Failed to load module "appmenu-gtk-module"`)
 	if regexAppmenuGtkModule.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"This error occurred: Failed to load module \"appmenu-gtk-module\" \n\n"+
@@ -1607,7 +1797,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "E: gnupg, gnupg2 and gnupg1 do not seem to be installed, but one of them is required for this operation"
-	regexGnupg := regexp.MustCompile(`E: gnupg, gnupg2 and gnupg1 do not seem to be installed, but one of them is required for this operation`)
 	if regexGnupg.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Repository-signing failed because gnpug is missing. This is installed by default on most systems, but on yours it's missing for some reason. \n\n"+
@@ -1617,7 +1806,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down"
-	regexDBus := regexp.MustCompile(`error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down`)
 	if regexDBus.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with your dbus connection. \n\n"+
@@ -1630,7 +1818,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "cat: /usr/share/i18n/SUPPORTED: No such file or directory"
-	regexI18n := regexp.MustCompile(`cat: /usr/share/i18n/SUPPORTED: No such file or directory`)
 	if regexI18n.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your system is messed up - the /usr/share/i18n/SUPPORTED file does not exist. \n\n"+
@@ -1640,7 +1827,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "is not in the sudoers file.  This incident will be reported."
-	regexSudoers := regexp.MustCompile(`is not in the sudoers file.  This incident will be reported.`)
 	if regexSudoers.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -1655,7 +1841,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "sudo: .* incorrect password attempts"
-	regexIncorrectPassword := regexp.MustCompile(`sudo: .* incorrect password attempts`)
 	if regexIncorrectPassword.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because you failed to type in the correct sudo password. \n\n"+
@@ -1664,7 +1849,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting"
-	regexSudoHost := regexp.MustCompile(`sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting`)
 	if regexSudoHost.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because your sudo command is incorrectly set up. \n\n"+
@@ -1673,7 +1857,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "/usr/bin/sudo: Operation not permitted"
-	regexSudoOperationNotPermitted := regexp.MustCompile(`/usr/bin/sudo: Operation not permitted`)
 	if regexSudoOperationNotPermitted.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because your sudo command is incorrectly set up. \n"+
@@ -1683,7 +1866,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "cpp.o: file not recognized: file truncated"
-	regexCpp := regexp.MustCompile(`cpp.o: file not recognized: file truncated`)
 	if regexCpp.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed. Try again, but please reach out to Pi-Apps developers for help if this same error keeps occurring.")
@@ -1691,7 +1873,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;"
-	regexTar := regexp.MustCompile(`tar: .* Wrote only .* of .* bytes\|tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;`)
 	if regexTar.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Extraction failed. Most likely this was a corrupted download, so please try again. \n\n"+
@@ -1700,7 +1881,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "xz: Cannot exec: No such file or directory"
-	regexXz := regexp.MustCompile(`xz: Cannot exec: No such file or directory`)
 	if regexXz.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Extraction failed because XZ is not installed. \n\n"+
@@ -1710,7 +1890,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "aria2c: error while loading shared libraries: /lib/arm-linux-gnueabihf/libaria2.so.0: unexpected reloc type 0xc8"
-	regexAria2c := regexp.MustCompile(`aria2c: error while loading shared libraries: /lib/arm-linux-gnueabihf/libaria2.so.0: unexpected reloc type 0xc8`)
 	if regexAria2c.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed because aria2c could not load the libaria2 library. \n\n"+
@@ -1720,7 +1899,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "errorCode=16 Failed to open the file .*, cause: Permission denied"
-	regexPermissionDenied := regexp.MustCompile(`errorCode=16 Failed to open the file .*, cause: Permission denied`)
 	if regexPermissionDenied.MatchString(errors) {
 		// Extract the file path from the error message
 		re := regexp.MustCompile(`errorCode=16 Failed to open the file (.*), cause: Permission denied`)
@@ -1740,7 +1918,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Reinstallation of .* is not possible, it cannot be downloaded\."
-	regexReinstall := regexp.MustCompile(`Reinstallation of .* is not possible, it cannot be downloaded\.`)
 	if regexReinstall.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your APT setup has been corrupted somehow. \n\n"+
@@ -1756,7 +1933,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "LZ4F: /var/lib/apt/lists/* Unexpected end of file"
-	regexLZ4FUnexpectedEOF := regexp.MustCompile(`E: LZ4F: /var/lib/apt/lists/.*\.lz4 Unexpected end of file'`)
 	if regexLZ4FUnexpectedEOF.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"APT reported a corrupted repo list file.\n"+
@@ -1768,7 +1944,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Structure needs cleaning"
-	regexStructureNeedsCleaning := regexp.MustCompile(`Structure needs cleaning`)
 	if regexStructureNeedsCleaning.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your have encountered the dreaded \"Structure needs cleaning\" error. This indicates file-corruption caused by improperly shutting down your computer. You are lucky your computer booted at all.\n\n"+
@@ -1780,7 +1955,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "VCHI initialization failed"
-	regexVCHI := regexp.MustCompile(`VCHI initialization failed`)
 	if regexVCHI.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -1796,7 +1970,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object"
-	regexFlatpak := regexp.MustCompile(`Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object`)
 	if regexFlatpak.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Flatpak failed to install something due to a past incompleted download. \n\n"+
@@ -1807,7 +1980,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "No space left on device"
-	regexSpace := regexp.MustCompile(`You don't have enough free space in\|No space left on device\|Not enough disk space to complete this operation\|Out of diskspace\|Cannot write to .* (Success)\.\|Delta requires .* GB free space, but only .* available\|err:setupapi:install_fake_dll failed to write to .* (error=0)\|fatal: sha1 file '.*' write error\. Out of diskspace`)
 	if regexSpace.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your system has insufficient disk space.\n\n"+
@@ -1816,7 +1988,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for permission denied when creating autostart entries
-	regexAutostart := regexp.MustCompile(`: line .*: \$HOME/\.config/autostart/.*\.desktop: Permission denied`)
 	if regexAutostart.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -1833,7 +2004,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "The directory '$HOME/\.cache/pip' or its parent directory is not owned by the current user"
-	regexCache := regexp.MustCompile(`The directory '(\$HOME|\$\{HOME\}|/home/[^/]+)/\.cache/pip' or its parent directory is not owned by the current user`)
 	if regexCache.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -1856,7 +2026,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "mkdir: cannot create directory .*/home/username/pi-apps-.*: Permission denied"
-	regexMkdir := regexp.MustCompile(`mkdir: cannot create directory .*/home/[^/]+/pi-apps-.*: Permission denied|rm: cannot remove .*/home/[^/]+/.*: Permission denied`)
 	if regexMkdir.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -1873,7 +2042,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for segmentation fault from linker
-	regexSegfault := regexp.MustCompile(`collect2: fatal error: ld terminated with signal 11 \[Segmentation fault\]`)
 	if regexSegfault.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to compile! The error was: \"collect2: fatal error: ld terminated with signal 11 [Segmentation fault]\"\n\n"+
@@ -1882,7 +2050,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "No LSB modules are available"
-	regexLsb := regexp.MustCompile(`ModuleNotFoundError: No module named 'lsb_release'`)
 	if regexLsb.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your lsb_release command seems to be incompletely installed. Try running this command to fix it: \n"+
@@ -1891,7 +2058,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "c++: fatal error: Killed signal terminated program cc1plus"
-	regexKilled := regexp.MustCompile(`c\+\+: fatal error: Killed signal terminated program cc1plus`)
 	if regexKilled.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed because cc1plus was killed due to insufficient RAM.\n\n"+
@@ -1901,7 +2067,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)"
-	regexRustKilled := regexp.MustCompile(`process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)`)
 	if regexRustKilled.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed because rustc was killed due to insufficient RAM.\n"+
@@ -1911,7 +2076,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for error: system does not fully support snapd: cannot mount squashfs image
-	regexSnapd := regexp.MustCompile(`error: system does not fully support snapd: cannot mount squashfs image`)
 	if regexSnapd.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Snap failed to fully install due to this error: 'error: system does not fully support snapd: cannot mount squashfs image'\n\n"+
@@ -1920,7 +2084,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Error: All VeraCrypt volumes must be dismounted first."
-	regexVeraCrypt := regexp.MustCompile(`Error: All VeraCrypt volumes must be dismounted first.`)
 	if regexVeraCrypt.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Error encountered: 'Error: All VeraCrypt volumes must be dismounted first.'\n\n"+
@@ -1945,7 +2108,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Failed to mount squashfs image"
-	regexMount := regexp.MustCompile(`Failed to mount squashfs image`)
 	if regexMount.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to mount squashfs image. This is most likely due to a failed installation of a package. Try reinstalling the package.")
@@ -1953,7 +2115,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for Rust version mismatch
-	regexRustVersion := regexp.MustCompile(`error: the current.*rustc .* is older than the minimum version required`)
 	if regexRustVersion.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because your Rust compiler (rustc) is too old for this project.\n\n"+
@@ -1963,7 +2124,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for permission issues with .cargo directory
-	regexCargoPermission := regexp.MustCompile(`failed to get metadata for.*: permission denied: .*\.cargo`)
 	if regexCargoPermission.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -1985,7 +2145,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for out of memory during Rust compilation
-	regexRustOOM := regexp.MustCompile(`(LLVM ERROR: out of memory|rustc.*internal compiler error.*out of memory|killed by the OOM killer)`)
 	if regexRustOOM.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because the system ran out of memory.\n\n"+
@@ -1998,7 +2157,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for target architecture issues
-	regexRustTarget := regexp.MustCompile(`error: failed to run custom build command for.*cross-compil|error: failed to run rustc to learn about target-specific information`)
 	if regexRustTarget.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed due to cross-compilation or target architecture issues.\n\n"+
@@ -2014,7 +2172,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// Check for user errors - these are errors that scripts deliberately output to diagnose issues
 
 	// Regular user error (reporting blocked)
-	regexUserError := regexp.MustCompile(`(?m)^User error: `)
 	if regexUserError.MatchString(errors) {
 		// Extract the error message - get only the lines that are part of the actual error
 		scanner := bufio.NewScanner(strings.NewReader(errors))
@@ -2046,7 +2203,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// User error with reporting allowed
-	regexUserErrorAllowed := regexp.MustCompile(`(?m)^User error \(reporting allowed\): `)
 	if regexUserErrorAllowed.MatchString(errors) {
 		// Extract the error message - get only the lines that are part of the actual error
 		scanner := bufio.NewScanner(strings.NewReader(errors))
@@ -2382,10 +2538,11 @@ func getCurrentSystemArchitecture() (string, error) {
 
 // extractForeignArchitectures extracts foreign architectures from APT error messages
 func extractForeignArchitectures(errors string) []string {
+	compileLogDiagnoseRegexes()
+
 	var architectures []string
 
 	// Regex to match architecture names in APT error messages
-	regexArchExtract := regexp.MustCompile(`(?:404.*Not Found.*|Ign:.*/) (i386|amd64|armhf|arm64|riscv64) Packages`)
 	matches := regexArchExtract.FindAllStringSubmatch(errors, -1)
 
 	for _, match := range matches {
@@ -24,8 +24,6 @@ package api
 import (
 	"bufio"
 	"bytes"
-	"crypto/sha1"
-	"encoding/hex"
 	"encoding/json"
 	"fmt"
 	"mime/multipart"
@@ -36,9 +34,7 @@ import (
 	"regexp"
 	"runtime"
 	"sort"
-	"strconv"
 	"strings"
-	"time"
 	"unsafe"
 )
 
@@ -94,21 +90,16 @@ func FormatLogfile(filename string) error {
 	return os.WriteFile(filename, []byte(formattedContent), 0644)
 }
 
-// GetDeviceInfo returns comprehensive system information about the device
+// GetDeviceInfo returns comprehensive system information about the device.
+// The hardware and OS probes come from the shared device-facts cache (see
+// device_facts.go), so formatting a batch of log files only runs them once.
 func GetDeviceInfo() (string, error) {
 	var info strings.Builder
+	facts := getDeviceFacts()
 
 	// Get OS info
-	if _, err := os.Stat("/etc/os-release"); err == nil {
-		osNameOutput, err := runCommand("grep", "PRETTY_NAME", "/etc/os-release")
-		if err == nil {
-			osName := strings.TrimSpace(osNameOutput)
-			osName = strings.TrimPrefix(osName, "PRETTY_NAME=")
-			osName = strings.Trim(osName, "\"")
-			info.WriteString("OS: " + osName + "\n")
-		} else {
-			info.WriteString("OS: Unknown\n")
-		}
+	if facts.OSPrettyName != "" {
+		info.WriteString("OS: " + facts.OSPrettyName + "\n")
 	} else {
 		info.WriteString("OS: Unknown\n")
 	}
@@ -117,165 +108,53 @@ func GetDeviceInfo() (string, error) {
 	arch := fmt.Sprintf("%d", unsafe.Sizeof(uintptr(0))*8)
 	info.WriteString("OS architecture: " + arch + "-bit\n")
 
-	// Get Pi-Apps information
-	piAppsDir := GetPiAppsDir() // Pi-Apps directory environment variable
-	if piAppsDir != "" && fileExists(piAppsDir) {
-		// Get last local update date using Go-native parsing
-		cmd := exec.Command("git", "-C", piAppsDir, "show", "-s", `--format=%ad`, "--date=short")
-		output, err := cmd.Output()
-		if err == nil && len(output) > 0 {
-			commitDate := strings.TrimSpace(string(output))
-			if commitDate != "" {
-				// commitDate should be in format YYYY-MM-DD
-				parsedTime, err := time.Parse("2006-01-02", commitDate)
-				if err == nil {
-					// Format to system default short date (as xargs date +%x would do)
-					localUpdateDate := parsedTime.Format("01/02/2006")
-					info.WriteString("Last updated Pi-Apps on: " + localUpdateDate + "\n")
-				} else {
-					info.WriteString("Last updated Pi-Apps on: " + commitDate + "\n")
-				}
-			}
-		}
-
-		// Get latest Pi-Apps version
-		gitURLPath := filepath.Join(piAppsDir, "etc", "git_url")
-		if fileExists(gitURLPath) {
-			// Read git URL from file
-			gitURLBytes, err := os.ReadFile(gitURLPath)
-			if err == nil {
-				gitURL := strings.TrimSpace(string(gitURLBytes))
-
-				// Parse account and repository from URL
-				parts := strings.Split(gitURL, "/")
-				if len(parts) >= 2 {
-					account := parts[len(parts)-2]
-					repo := parts[len(parts)-1]
-
-					// Make HTTP request to GitHub API
-					apiURL := fmt.Sprintf("https://api.github.com/repos/%s/%s/commits/master", account, repo)
-
-					// Create request with optional GitHub API key
-					req, err := http.NewRequest("GET", apiURL, nil)
-					if err == nil {
-						// Add GitHub API key if available
-						if apiKey := os.Getenv("GITHUB_API_KEY"); apiKey != "" {
-							req.Header.Set("Authorization", "token "+apiKey)
-						}
-
-						// Make the request
-						client := &http.Client{}
-						resp, err := client.Do(req)
-						if err == nil {
-							defer resp.Body.Close()
-
-							// Parse JSON response
-							var commits []struct {
-								Commit struct {
-									Author struct {
-										Date string `json:"date"`
-									} `json:"author"`
-								} `json:"commit"`
-							}
-
-							if err := json.NewDecoder(resp.Body).Decode(&commits); err == nil && len(commits) > 0 {
-								// Parse the ISO date and format it
-								date, err := time.Parse(time.RFC3339, commits[0].Commit.Author.Date)
-								if err == nil {
-									dateStr := date.Format("01/02/2006")
-									info.WriteString("Latest Pi-Apps version: " + dateStr + "\n")
-								}
-							}
-						}
-					}
-				}
-			}
-		}
+	// Get Pi-Apps update information (cached for the process lifetime)
+	localUpdateDate, latestVersionDate := piAppsUpdateDates()
+	if localUpdateDate != "" {
+		info.WriteString("Last updated Pi-Apps on: " + localUpdateDate + "\n")
+	}
+	if latestVersionDate != "" {
+		info.WriteString("Latest Pi-Apps version: " + latestVersionDate + "\n")
 	}
 
 	// Get kernel info
-	kernelArchOutput, err := runCommand("uname", "-m")
-	kernelVersionOutput, err2 := runCommand("uname", "-r")
-	if err == nil && err2 == nil {
-		info.WriteString("Kernel: " + strings.TrimSpace(kernelArchOutput) + " " + strings.TrimSpace(kernelVersionOutput) + "\n")
+	if facts.KernelArch != "" && facts.KernelVersion != "" {
+		info.WriteString("Kernel: " + facts.KernelArch + " " + facts.KernelVersion + "\n")
 	} else {
 		info.WriteString("Kernel: Unknown\n")
 	}
 
 	// Get device model and SoC information
-	model, socID := GetDeviceModel()
-	info.WriteString("Device model: " + model + "\n")
+	info.WriteString("Device model: " + facts.Model + "\n")
 
 	// Add SoC information if available
-	if socID != "" {
-		info.WriteString("SOC identifier: " + socID + "\n")
+	if facts.SocID != "" {
+		info.WriteString("SOC identifier: " + facts.SocID + "\n")
 	}
 
 	// Get hashed machine-id
-	if _, err := os.Stat("/etc/machine-id"); err == nil {
-		machineIDBytes, err := os.ReadFile("/etc/machine-id")
-		if err == nil {
-			hasher := sha1.New()
-			hasher.Write(machineIDBytes)
-			hash := hex.EncodeToString(hasher.Sum(nil))
-			info.WriteString("Machine-id (hashed): " + hash + "\n")
-		}
+	if facts.MachineID != "" {
+		info.WriteString("Machine-id (hashed): " + facts.MachineID + "\n")
 	}
 
 	// Get hashed serial-number
-	if _, err := os.Stat("/sys/firmware/devicetree/base/serial-number"); err == nil {
-		serialBytes, err := os.ReadFile("/sys/firmware/devicetree/base/serial-number")
-		if err == nil {
-			hasher := sha1.New()
-			hasher.Write(serialBytes)
-			hash := hex.EncodeToString(hasher.Sum(nil))
-			info.WriteString("Serial-number (hashed): " + hash + "\n")
-		}
+	if facts.SerialNumber != "" {
+		info.WriteString("Serial-number (hashed): " + facts.SerialNumber + "\n")
 	}
 
 	// Get CPU name
-	if cpuInfo, err := os.ReadFile("/proc/cpuinfo"); err == nil {
-		scanner := bufio.NewScanner(bytes.NewReader(cpuInfo))
-		for scanner.Scan() {
-			line := scanner.Text()
-			if strings.HasPrefix(line, "model name") {
-				parts := strings.Split(line, ":")
-				if len(parts) > 1 {
-					info.WriteString("CPU name: " + strings.TrimSpace(parts[1]) + "\n")
-					break
-				}
-			}
-		}
+	if facts.CPUName != "" {
+		info.WriteString("CPU name: " + facts.CPUName + "\n")
 	}
 
 	// Get RAM size
-	if memInfo, err := os.ReadFile("/proc/meminfo"); err == nil {
-		scanner := bufio.NewScanner(bytes.NewReader(memInfo))
-		for scanner.Scan() {
-			line := scanner.Text()
-			if strings.HasPrefix(line, "MemTotal") {
-				parts := strings.Fields(line)
-				if len(parts) > 1 {
-					memKB, _ := strconv.ParseFloat(parts[1], 64)
-					memGB := memKB / 1024000.0
-					info.WriteString(fmt.Sprintf("RAM size: %.2f GB\n", memGB))
-					break
-				}
-			}
-		}
+	if facts.RAMGB > 0 {
+		info.WriteString(fmt.Sprintf("RAM size: %.2f GB\n", facts.RAMGB))
 	}
 
 	// Get Raspberry Pi OS image version
-	if rpiIssue, err := os.ReadFile("/etc/rpi-issue"); err == nil {
-		scanner := bufio.NewScanner(bytes.NewReader(rpiIssue))
-		for scanner.Scan() {
-			line := scanner.Text()
-			if strings.Contains(line, "Raspberry Pi reference") {
-				version := strings.TrimPrefix(line, "Raspberry Pi reference ")
-				info.WriteString("Raspberry Pi OS image version: " + strings.TrimSpace(version) + "\n")
-				break
-			}
-		}
+	if facts.RPiImageVersion != "" {
+		info.WriteString("Raspberry Pi OS image version: " + facts.RPiImageVersion + "\n")
 	}
 
 	// Get language settings
@@ -326,16 +205,8 @@ func RemoveAnsiEscapes(input string) string {
 	// Replace \r with \n
 	input = strings.ReplaceAll(input, "\r", "\n")
 
-	// Remove various ANSI escape sequences
-	regexes := []*regexp.Regexp{
-		regexp.MustCompile(`\x1b\[?[0-9;]*[a-zA-Z]`),
-		regexp.MustCompile(`\x1b\[[0-9;]*[a-zA-Z]`),
-		regexp.MustCompile(`\x1b\[[0-9;]*`),
-	}
-
-	for _, regex := range regexes {
-		input = regex.ReplaceAllString(input, "")
-	}
+	// Remove ANSI escape sequences
+	input = stripAnsiString(input)
 
 	// Remove progress bar lines
 	progressBarRegex := regexp.MustCompile(`\.{10} \.{10} \.{10} \.{10} \.{9}`)
@@ -28,8 +28,123 @@ import (
 	"path/filepath"
 	"regexp"
 	"strings"
+	"sync"
 )
 
+// Regexes used by the log diagnosis checks. They are compiled together the
+// first time a log is diagnosed, so a batch of failed apps only pays the
+// compilation cost once per process.
+var (
+	logDiagnoseRegexOnce sync.Once
+
+	regexAnboxCompileFailure    *regexp.Regexp
+	regexXoneCompileFailure     *regexp.Regexp
+	regexReinstallVulkan        *regexp.Regexp
+	regexDependencyConflict     *regexp.Regexp
+	regexInternetError          *regexp.Regexp
+	regexFetchPack              *regexp.Regexp
+	regexFatalObject            *regexp.Regexp
+	regexRemoteEndHungUp        *regexp.Regexp
+	regexSslError               *regexp.Regexp
+	regexCurlError              *regexp.Regexp
+	regexAuthorizationFailed    *regexp.Regexp
+	regexFlathubError           *regexp.Regexp
+	regexTlsError               *regexp.Regexp
+	regexGnuTlsError            *regexp.Regexp
+	regexConnectException       *regexp.Regexp
+	regexCrateNotFound          *regexp.Regexp
+	regexCargoNetwork           *regexp.Regexp
+	regexHashDoesNotMatch       *regexp.Regexp
+	regexModuleNotFound         *regexp.Regexp
+	regexAppmenuGtkModule       *regexp.Regexp
+	regexDBus                   *regexp.Regexp
+	regexI18n                   *regexp.Regexp
+	regexSudoers                *regexp.Regexp
+	regexIncorrectPassword      *regexp.Regexp
+	regexSudoHost               *regexp.Regexp
+	regexCpp                    *regexp.Regexp
+	regexTar                    *regexp.Regexp
+	regexXz                     *regexp.Regexp
+	regexAria2c                 *regexp.Regexp
+	regexPermissionDenied       *regexp.Regexp
+	regexStructureNeedsCleaning *regexp.Regexp
+	regexVCHI                   *regexp.Regexp
+	regexFlatpak                *regexp.Regexp
+	regexSpace                  *regexp.Regexp
+	regexAutostart              *regexp.Regexp
+	regexCache                  *regexp.Regexp
+	regexMkdir                  *regexp.Regexp
+	regexSegfault               *regexp.Regexp
+	regexLsb                    *regexp.Regexp
+	regexKilled                 *regexp.Regexp
+	regexRustKilled             *regexp.Regexp
+	regexSnapd                  *regexp.Regexp
+	regexVeraCrypt              *regexp.Regexp
+	regexMount                  *regexp.Regexp
+	regexRustVersion            *regexp.Regexp
+	regexCargoPermission        *regexp.Regexp
+	regexRustOOM                *regexp.Regexp
+	regexRustTarget             *regexp.Regexp
+	regexUserError              *regexp.Regexp
+	regexUserErrorAllowed       *regexp.Regexp
+)
+
+// compileLogDiagnoseRegexes compiles the diagnosis pattern table on first use
+func compileLogDiagnoseRegexes() {
+	logDiagnoseRegexOnce.Do(func() {
+		regexAnboxCompileFailure = regexp.MustCompile(`Consult /var/lib/dkms/anbox-ashmem/1/build/make.log for more information.`)
+		regexXoneCompileFailure = regexp.MustCompile(`M=/var/lib/dkms/xone.*bad exit status`)
+		regexReinstallVulkan = regexp.MustCompile(`Reinstalling Vulkan driver`)
+		regexDependencyConflict = regexp.MustCompile(`error: failed to select a version for the requirement.*version conflict`)
+		regexInternetError = regexp.MustCompile(`Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out`)
+		regexFetchPack = regexp.MustCompile(`fetch-pack: unexpected disconnect while reading sideband packet`)
+		regexFatalObject = regexp.MustCompile(`fatal: did not receive expected object`)
+		regexRemoteEndHungUp = regexp.MustCompile(`fatal: the remote end hung up unexpectedly`)
+		regexSslError = regexp.MustCompile(`SSL/TLS handshake failure\|total length mismatch\|failed to establish connection\|timeout\|connection reset by peer\|name resolution failed\|temporary failure in name resolution\|unable to establish SSL connection\|connection closed at byte\|read error at byte\|failed: No route to host\|invalid range header\|curl error\|response status not successful\|download snap\|dial tcp\|lookup api\.snapcraft\.io\|fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server\|RPC failed; curl .* transfer closed with outstanding read data remaining\|RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received.\|SSL error\|failure when receiving data from the peer\|java\.net\.SocketTimeoutException: Read timed out`)
+		regexCurlError = regexp.MustCompile(`curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)`)
+		regexAuthorizationFailed = regexp.MustCompile(`errorCode=24 Authorization failed.`)
+		regexFlathubError = regexp.MustCompile(`flathub: Error resolving .dl\.flathub\.org.`)
+		regexTlsError = regexp.MustCompile(`The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate`)
+		regexGnuTlsError = regexp.MustCompile(`GnuTLS recv error (-54): Error in the pull function.`)
+		regexConnectException = regexp.MustCompile(`java\.net\.ConnectException: Connection refused`)
+		regexCrateNotFound = regexp.MustCompile(`error: failed to get .*? as a dependency.*no matching package named`)
+		regexCargoNetwork = regexp.MustCompile(`error: failed to fetch from.*could not connect to server|error: failed to fetch.*Network is unreachable`)
+		regexHashDoesNotMatch = regexp.MustCompile(`ERROR: Downloaded system image hash doesn't match, expected`)
+		regexModuleNotFound = regexp.MustCompile(`modprobe: FATAL: Module .* not found in directory`)
+		regexAppmenuGtkModule = regexp.MustCompile(`Failed to load module "appmenu-gtk-module"`)
+		regexDBus = regexp.MustCompile(`error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down`)
+		regexI18n = regexp.MustCompile(`cat: /usr/share/i18n/SUPPORTED: No such file or directory`)
+		regexSudoers = regexp.MustCompile(`is not in the sudoers file.  This incident will be reported.`)
+		regexIncorrectPassword = regexp.MustCompile(`sudo: .* incorrect password attempts`)
+		regexSudoHost = regexp.MustCompile(`sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting`)
+		regexCpp = regexp.MustCompile(`cpp.o: file not recognized: file truncated`)
+		regexTar = regexp.MustCompile(`tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;`)
+		regexXz = regexp.MustCompile(`xz: Cannot exec: No such file or directory`)
+		regexAria2c = regexp.MustCompile(`aria2c: error while loading shared libraries: /lib/arm-linux-gnueabihf/libaria2.so.0: unexpected reloc type 0xc8`)
+		regexPermissionDenied = regexp.MustCompile(`errorCode=16 Failed to open the file .*, cause: Permission denied`)
+		regexStructureNeedsCleaning = regexp.MustCompile(`Structure needs cleaning`)
+		regexVCHI = regexp.MustCompile(`VCHI initialization failed`)
+		regexFlatpak = regexp.MustCompile(`Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object`)
+		regexSpace = regexp.MustCompile(`No space left on device\|Not enough disk space to complete this operation\|You don't have enough free space in\|Cannot write to .* (Success)\.`)
+		regexAutostart = regexp.MustCompile(`: line .*: \$HOME/\.config/autostart/.*\.desktop: Permission denied`)
+		regexCache = regexp.MustCompile(`The directory '(\$HOME|\$\{HOME\}|/home/[^/]+)/\.cache/pip' or its parent directory is not owned by the current user`)
+		regexMkdir = regexp.MustCompile(`mkdir: cannot create directory .*/home/[^/]+/pi-apps-.*: Permission denied|rm: cannot remove .*/home/[^/]+/.*: Permission denied`)
+		regexSegfault = regexp.MustCompile(`collect2: fatal error: ld terminated with signal 11 \[Segmentation fault\]`)
+		regexLsb = regexp.MustCompile(`ModuleNotFoundError: No module named 'lsb_release'`)
+		regexKilled = regexp.MustCompile(`c\+\+: fatal error: Killed signal terminated program cc1plus`)
+		regexRustKilled = regexp.MustCompile(`process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)`)
+		regexSnapd = regexp.MustCompile(`error: system does not fully support snapd: cannot mount squashfs image`)
+		regexVeraCrypt = regexp.MustCompile(`Error: All VeraCrypt volumes must be dismounted first.`)
+		regexMount = regexp.MustCompile(`Failed to mount squashfs image`)
+		regexRustVersion = regexp.MustCompile(`error: the current.*rustc .* is older than the minimum version required`)
+		regexCargoPermission = regexp.MustCompile(`failed to get metadata for.*: permission denied: .*\.cargo`)
+		regexRustOOM = regexp.MustCompile(`(LLVM ERROR: out of memory|rustc.*internal compiler error.*out of memory|killed by the OOM killer)`)
+		regexRustTarget = regexp.MustCompile(`error: failed to run custom build command for.*cross-compil|error: failed to run rustc to learn about target-specific information`)
+		regexUserError = regexp.MustCompile(`(?m)^User error: `)
+		regexUserErrorAllowed = regexp.MustCompile(`(?m)^User error \(reporting allowed\): `)
+	})
+}
+
 // LogDiagnose analyzes a logfile and returns diagnostic information
 //
 // It takes a logfile path and an allowWrite parameter
@@ -37,6 +152,8 @@ import (
 //	ErrorDiagnosis - the error diagnosis
 //	error - error if logfile is not specified
 func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
+	compileLogDiagnoseRegexes()
+
 	// Read the logfile
 	content, err := os.ReadFile(logfilePath)
 	if err != nil {
@@ -66,7 +183,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	//------------------------------------------
 
 	// check for "Consult /var/lib/dkms/anbox-ashmem/1/build/make.log for more information."
-	regexAnboxCompileFailure := regexp.MustCompile(`Consult /var/lib/dkms/anbox-ashmem/1/build/make.log for more information.`)
 	if regexAnboxCompileFailure.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Anbox kernel modules no longer compile on the latest kernel. You need to remove it for the kernel to fully install and for APT to work.\n"+
@@ -76,7 +192,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "M=/var/lib/dkms/xone.*bad exit status"
-	regexXoneCompileFailure := regexp.MustCompile(`M=/var/lib/dkms/xone.*bad exit status`)
 	if regexXoneCompileFailure.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The Xone kernel module no longer compile on the latest kernel. You need to remove it for the kernel to fully install and for APT to work.\n"+
@@ -86,7 +201,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Reinstalling Vulkan driver"
-	regexReinstallVulkan := regexp.MustCompile(`Reinstalling Vulkan driver`)
 	if regexReinstallVulkan.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"PiKiss has installed a broken custom vulkan reinstallation apt hook. As a result, dpkg and APT won't work properly.")
@@ -98,7 +212,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// cargo package errors below
 
 	// Check for incompatible dependencies
-	regexDependencyConflict := regexp.MustCompile(`error: failed to select a version for the requirement.*version conflict`)
 	if regexDependencyConflict.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed due to conflicting dependency requirements.\n\n"+
@@ -110,7 +223,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// internet errors below
 
 	// check for "Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out" aka internet errors
-	regexInternetError := regexp.MustCompile(`Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out`)
 	if regexInternetError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to connect to github.com.\n\n"+
@@ -119,7 +231,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fetch-pack: unexpected disconnect while reading sideband packet" aka git errors
-	regexFetchPack := regexp.MustCompile(`fetch-pack: unexpected disconnect while reading sideband packet`)
 	if regexFetchPack.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fetch-pack: unexpected disconnect while reading sideband packet\" Check the stability of your Internet connection and try again. \n\n"+
@@ -128,7 +239,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fatal: did not receive expected object" aka git errors
-	regexFatalObject := regexp.MustCompile(`fatal: did not receive expected object`)
 	if regexFatalObject.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fatal: did not receive expected object\" Check the stability of your Internet connection and try again.\n\n"+
@@ -137,7 +247,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fatal: the remote end hung up unexpectedly" aka git errors
-	regexRemoteEndHungUp := regexp.MustCompile(`fatal: the remote end hung up unexpectedly`)
 	if regexRemoteEndHungUp.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fatal: the remote end hung up unexpectedly\" Check the stability of your Internet connection and try again.\n\n"+
@@ -146,7 +255,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for SSL/TLS handshake failure, total length mismatch, failed to establish connection, timeout, connection reset by peer, name resolution failed, temporary failure in name resolution, unable to establish SSL connection, connection closed at byte, read error at byte, failed: No route to host, invalid range header, curl error, response status not successful, download snap, dial tcp, lookup api.snapcraft.io, fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server, RPC failed; curl .* transfer closed with outstanding read data remaining, RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received., SSL error, failure when receiving data from the peer, java.net.SocketTimeoutException: Read timed out which include git errors
-	regexSslError := regexp.MustCompile(`SSL/TLS handshake failure\|total length mismatch\|failed to establish connection\|timeout\|connection reset by peer\|name resolution failed\|temporary failure in name resolution\|unable to establish SSL connection\|connection closed at byte\|read error at byte\|failed: No route to host\|invalid range header\|curl error\|response status not successful\|download snap\|dial tcp\|lookup api\.snapcraft\.io\|fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server\|RPC failed; curl .* transfer closed with outstanding read data remaining\|RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received.\|SSL error\|failure when receiving data from the peer\|java\.net\.SocketTimeoutException: Read timed out`)
 	if regexSslError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"SSL/TLS handshake failure\" Check the stability of your Internet connection and try again.")
@@ -154,7 +262,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)"
-	regexCurlError := regexp.MustCompile(`curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)`)
 	if regexCurlError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed due to an internal curl error. This could be an internet issue or hardware problem. \n"+
@@ -163,7 +270,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "errorCode=24 Authorization failed."
-	regexAuthorizationFailed := regexp.MustCompile(`errorCode=24 Authorization failed.`)
 	if regexAuthorizationFailed.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The curl command encountered this error: \"errorCode=24 Authorization failed.\" Check the stability of your Internet connection and try again.")
@@ -171,7 +277,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "flathub: Error resolving .dl\.flathub\.org."
-	regexFlathubError := regexp.MustCompile(`flathub: Error resolving .dl\.flathub\.org.`)
 	if regexFlathubError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The flathub command encountered this error: \"flathub: Error resolving .dl.flathub.org.\" Check the stability of your Internet connection and try again.")
@@ -179,7 +284,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate"
-	regexTlsError := regexp.MustCompile(`The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate`)
 	if regexTlsError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The TLS connection was non-properly terminated. Check the stability of your Internet connection and try again.")
@@ -187,7 +291,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "GnuTLS recv error (-54): Error in the pull function."
-	regexGnuTlsError := regexp.MustCompile(`GnuTLS recv error (-54): Error in the pull function.`)
 	if regexGnuTlsError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed due to an issue with your internet, not Pi-Apps. The connection was terminated before the download completed. \n\n"+
@@ -197,7 +300,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "java.net.ConnectException: Connection refused"
-	regexConnectException := regexp.MustCompile(`java\.net\.ConnectException: Connection refused`)
 	if regexConnectException.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed. Check your internet connection and firewall, then try again.")
@@ -205,7 +307,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cargo crate not found error
-	regexCrateNotFound := regexp.MustCompile(`error: failed to get .*? as a dependency.*no matching package named`)
 	if regexCrateNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because a required crate dependency was not found.\n\n"+
@@ -218,7 +319,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cargo network errors
-	regexCargoNetwork := regexp.MustCompile(`error: failed to fetch from.*could not connect to server|error: failed to fetch.*Network is unreachable`)
 	if regexCargoNetwork.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Cargo couldn't connect to the crates.io registry or other dependency sources.\n\n"+
@@ -227,7 +327,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for ERROR: Downloaded system image hash doesn't match, expected <hash> from Waydroid
-	regexHashDoesNotMatch := regexp.MustCompile(`ERROR: Downloaded system image hash doesn't match, expected`)
 	if regexHashDoesNotMatch.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Waydroid OS image download failed. Check your internet connection and firewall, then try again.")
@@ -237,7 +336,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// other system errors below
 
 	// check for modprobe: FATAL: Module .* not found in directory
-	regexModuleNotFound := regexp.MustCompile(`modprobe: FATAL: Module .* not found in directory`)
 	if regexModuleNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with the kernel modules. Try rebooting if your kernel was upgraded. \n\n"+
@@ -248,7 +346,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Failed to load module \"appmenu-gtk-module\""
-	regexAppmenuGtkModule := regexp.MustCompile(`Failed to load module "appmenu-gtk-module"`)
 	if regexAppmenuGtkModule.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"This error occurred: Failed to load module \"appmenu-gtk-module\" \n\n"+
@@ -259,7 +356,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down"
-	regexDBus := regexp.MustCompile(`error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down`)
 	if regexDBus.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with your dbus connection. \n\n"+
@@ -272,7 +368,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "cat: /usr/share/i18n/SUPPORTED: No such file or directory"
-	regexI18n := regexp.MustCompile(`cat: /usr/share/i18n/SUPPORTED: No such file or directory`)
 	if regexI18n.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your system is messed up - the /usr/share/i18n/SUPPORTED file does not exist. \n\n"+
@@ -282,7 +377,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "is not in the sudoers file.  This incident will be reported."
-	regexSudoers := regexp.MustCompile(`is not in the sudoers file.  This incident will be reported.`)
 	if regexSudoers.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -297,7 +391,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "sudo: .* incorrect password attempts"
-	regexIncorrectPassword := regexp.MustCompile(`sudo: .* incorrect password attempts`)
 	if regexIncorrectPassword.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because you failed to type in the correct sudo password. \n\n"+
@@ -306,7 +399,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting"
-	regexSudoHost := regexp.MustCompile(`sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting`)
 	if regexSudoHost.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because your sudo command is incorrectly set up. \n\n"+
@@ -315,7 +407,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "cpp.o: file not recognized: file truncated"
-	regexCpp := regexp.MustCompile(`cpp.o: file not recognized: file truncated`)
 	if regexCpp.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed. Try again, but please reach out to Pi-Apps developers for help if this same error keeps occurring.")
@@ -323,7 +414,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;"
-	regexTar := regexp.MustCompile(`tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;`)
 	if regexTar.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Extraction failed. Most likely this was a corrupted download, so please try again. \n\n"+
@@ -332,7 +422,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "xz: Cannot exec: No such file or directory"
-	regexXz := regexp.MustCompile(`xz: Cannot exec: No such file or directory`)
 	if regexXz.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Extraction failed because XZ is not installed. \n\n"+
@@ -342,7 +431,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "aria2c: error while loading shared libraries: /lib/arm-linux-gnueabihf/libaria2.so.0: unexpected reloc type 0xc8"
-	regexAria2c := regexp.MustCompile(`aria2c: error while loading shared libraries: /lib/arm-linux-gnueabihf/libaria2.so.0: unexpected reloc type 0xc8`)
 	if regexAria2c.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed because aria2c could not load the libaria2 library. \n\n"+
@@ -352,7 +440,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "errorCode=16 Failed to open the file .*, cause: Permission denied"
-	regexPermissionDenied := regexp.MustCompile(`errorCode=16 Failed to open the file .*, cause: Permission denied`)
 	if regexPermissionDenied.MatchString(errors) {
 		// Extract the file path from the error message
 		re := regexp.MustCompile(`errorCode=16 Failed to open the file (.*), cause: Permission denied`)
@@ -372,7 +459,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Structure needs cleaning"
-	regexStructureNeedsCleaning := regexp.MustCompile(`Structure needs cleaning`)
 	if regexStructureNeedsCleaning.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your have encountered the dreaded \"Structure needs cleaning\" error. This indicates file-corruption caused by improperly shutting down your computer. You are lucky your computer booted at all.\n\n"+
@@ -384,7 +470,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "VCHI initialization failed"
-	regexVCHI := regexp.MustCompile(`VCHI initialization failed`)
 	if regexVCHI.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -400,7 +485,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object"
-	regexFlatpak := regexp.MustCompile(`Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object`)
 	if regexFlatpak.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Flatpak failed to install something due to a past incompleted download. \n\n"+
@@ -411,7 +495,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "No space left on device"
-	regexSpace := regexp.MustCompile(`No space left on device\|Not enough disk space to complete this operation\|You don't have enough free space in\|Cannot write to .* (Success)\.`)
 	if regexSpace.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your system has insufficient disk space.\n\n"+
@@ -420,7 +503,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for permission denied when creating autostart entries
-	regexAutostart := regexp.MustCompile(`: line .*: \$HOME/\.config/autostart/.*\.desktop: Permission denied`)
 	if regexAutostart.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -437,7 +519,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "The directory '$HOME/\.cache/pip' or its parent directory is not owned by the current user"
-	regexCache := regexp.MustCompile(`The directory '(\$HOME|\$\{HOME\}|/home/[^/]+)/\.cache/pip' or its parent directory is not owned by the current user`)
 	if regexCache.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -460,7 +541,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "mkdir: cannot create directory .*/home/username/pi-apps-.*: Permission denied"
-	regexMkdir := regexp.MustCompile(`mkdir: cannot create directory .*/home/[^/]+/pi-apps-.*: Permission denied|rm: cannot remove .*/home/[^/]+/.*: Permission denied`)
 	if regexMkdir.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -477,7 +557,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for segmentation fault from linker
-	regexSegfault := regexp.MustCompile(`collect2: fatal error: ld terminated with signal 11 \[Segmentation fault\]`)
 	if regexSegfault.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to compile! The error was: \"collect2: fatal error: ld terminated with signal 11 [Segmentation fault]\"\n\n"+
@@ -486,7 +565,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "No LSB modules are available"
-	regexLsb := regexp.MustCompile(`ModuleNotFoundError: No module named 'lsb_release'`)
 	if regexLsb.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your lsb_release command seems to be incompletely installed. Try running this command to fix it: \n"+
@@ -495,7 +573,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "c++: fatal error: Killed signal terminated program cc1plus"
-	regexKilled := regexp.MustCompile(`c\+\+: fatal error: Killed signal terminated program cc1plus`)
 	if regexKilled.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed because cc1plus was killed due to insufficient RAM.\n\n"+
@@ -505,7 +582,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)"
-	regexRustKilled := regexp.MustCompile(`process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)`)
 	if regexRustKilled.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed because rustc was killed due to insufficient RAM.\n"+
@@ -515,7 +591,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for error: system does not fully support snapd: cannot mount squashfs image
-	regexSnapd := regexp.MustCompile(`error: system does not fully support snapd: cannot mount squashfs image`)
 	if regexSnapd.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Snap failed to fully install due to this error: 'error: system does not fully support snapd: cannot mount squashfs image'\n\n"+
@@ -524,7 +599,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Error: All VeraCrypt volumes must be dismounted first."
-	regexVeraCrypt := regexp.MustCompile(`Error: All VeraCrypt volumes must be dismounted first.`)
 	if regexVeraCrypt.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Error encountered: 'Error: All VeraCrypt volumes must be dismounted first.'\n\n"+
@@ -533,7 +607,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Failed to mount squashfs image"
-	regexMount := regexp.MustCompile(`Failed to mount squashfs image`)
 	if regexMount.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to mount squashfs image. This is most likely due to a failed installation of a package. Try reinstalling the package.")
@@ -541,7 +614,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for Rust version mismatch
-	regexRustVersion := regexp.MustCompile(`error: the current.*rustc .* is older than the minimum version required`)
 	if regexRustVersion.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because your Rust compiler (rustc) is too old for this project.\n\n"+
@@ -551,7 +623,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for permission issues with .cargo directory
-	regexCargoPermission := regexp.MustCompile(`failed to get metadata for.*: permission denied: .*\.cargo`)
 	if regexCargoPermission.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -573,7 +644,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for out of memory during Rust compilation
-	regexRustOOM := regexp.MustCompile(`(LLVM ERROR: out of memory|rustc.*internal compiler error.*out of memory|killed by the OOM killer)`)
 	if regexRustOOM.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because the system ran out of memory.\n\n"+
@@ -586,7 +656,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for target architecture issues
-	regexRustTarget := regexp.MustCompile(`error: failed to run custom build command for.*cross-compil|error: failed to run rustc to learn about target-specific information`)
 	if regexRustTarget.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed due to cross-compilation or target architecture issues.\n\n"+
@@ -600,7 +669,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// Check for user errors - these are errors that scripts deliberately output to diagnose issues
 
 	// Regular user error (reporting blocked)
-	regexUserError := regexp.MustCompile(`(?m)^User error: `)
 	if regexUserError.MatchString(errors) {
 		// Extract the error message - get only the lines that are part of the actual error
 		scanner := bufio.NewScanner(strings.NewReader(errors))
@@ -632,7 +700,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// User error with reporting allowed
-	regexUserErrorAllowed := regexp.MustCompile(`(?m)^User error \(reporting allowed\): `)
 	if regexUserErrorAllowed.MatchString(errors) {
 		// Extract the error message - get only the lines that are part of the actual error
 		scanner := bufio.NewScanner(strings.NewReader(errors))
@@ -0,0 +1,158 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: log_diagnose_match.go
+// Description: Multi-pattern literal matcher for log diagnosis. The
+// package-manager diagnosers check failure logs against hundreds of literal
+// substrings; instead of one strings.Contains scan per pattern, the
+// patterns are compiled into an Aho-Corasick automaton (lazily, once per
+// process) and every log is scanned in a single pass.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"strings"
+	"sync"
+)
+
+// acNode is one state of the Aho-Corasick automaton
+type acNode struct {
+	next map[byte]int32
+	fail int32
+	out  []int32 // indexes of patterns ending at this state
+}
+
+// ahoCorasick is a compiled multi-pattern literal matcher
+type ahoCorasick struct {
+	nodes    []acNode
+	patterns []string
+}
+
+// newAhoCorasick compiles the given literal patterns into an automaton
+func newAhoCorasick(patterns []string) *ahoCorasick {
+	a := &ahoCorasick{
+		nodes:    []acNode{{next: make(map[byte]int32)}},
+		patterns: patterns,
+	}
+
+	// Build the trie
+	for i, pattern := range patterns {
+		state := int32(0)
+		for j := 0; j < len(pattern); j++ {
+			c := pattern[j]
+			child, ok := a.nodes[state].next[c]
+			if !ok {
+				child = int32(len(a.nodes))
+				a.nodes = append(a.nodes, acNode{next: make(map[byte]int32)})
+				a.nodes[state].next[c] = child
+			}
+			state = child
+		}
+		a.nodes[state].out = append(a.nodes[state].out, int32(i))
+	}
+
+	// Build the failure links breadth-first
+	queue := make([]int32, 0, len(a.nodes))
+	for _, child := range a.nodes[0].next {
+		queue = append(queue, child)
+	}
+	for len(queue) > 0 {
+		state := queue[0]
+		queue = queue[1:]
+		for c, child := range a.nodes[state].next {
+			queue = append(queue, child)
+
+			fail := a.nodes[state].fail
+			for fail != 0 {
+				if next, ok := a.nodes[fail].next[c]; ok {
+					fail = next
+					break
+				}
+				fail = a.nodes[fail].fail
+			}
+			if fail == 0 {
+				if next, ok := a.nodes[0].next[c]; ok && next != child {
+					fail = next
+				}
+			}
+			a.nodes[child].fail = fail
+			a.nodes[child].out = append(a.nodes[child].out, a.nodes[fail].out...)
+		}
+	}
+
+	return a
+}
+
+// scan walks the text once, calling fn with the pattern index and the
+// offset just past each match
+func (a *ahoCorasick) scan(text string, fn func(pattern int32, end int)) {
+	state := int32(0)
+	for i := 0; i < len(text); i++ {
+		c := text[i]
+		for {
+			if next, ok := a.nodes[state].next[c]; ok {
+				state = next
+				break
+			}
+			if state == 0 {
+				break
+			}
+			state = a.nodes[state].fail
+		}
+		for _, pattern := range a.nodes[state].out {
+			fn(pattern, i+1)
+		}
+	}
+}
+
+// logMatchSet records where each diagnosis pattern matched in one log
+type logMatchSet struct {
+	content   string
+	positions map[string][]int
+}
+
+// Automaton cache, built lazily the first time a log is diagnosed (only one
+// pattern table exists per build, so a single slot suffices)
+var (
+	logPatternOnce      sync.Once
+	logPatternAutomaton *ahoCorasick
+)
+
+// scanLogPatterns matches every pattern against the log in a single pass
+// and returns the set of matches with their positions
+func scanLogPatterns(content string, patterns []string) *logMatchSet {
+	logPatternOnce.Do(func() {
+		logPatternAutomaton = newAhoCorasick(patterns)
+	})
+
+	matches := &logMatchSet{content: content, positions: make(map[string][]int)}
+	logPatternAutomaton.scan(content, func(pattern int32, end int) {
+		name := logPatternAutomaton.patterns[pattern]
+		matches.positions[name] = append(matches.positions[name], end-len(name))
+	})
+	return matches
+}
+
+// contains reports whether the pattern matched anywhere in the log. Patterns
+// outside the compiled table (e.g. built at runtime) fall back to a direct
+// scan so callers never miss a match.
+func (m *logMatchSet) contains(pattern string) bool {
+	if positions, ok := m.positions[pattern]; ok {
+		return len(positions) > 0
+	}
+	return strings.Contains(m.content, pattern)
+}
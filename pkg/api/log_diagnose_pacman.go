@@ -28,8 +28,143 @@ import (
 	"path/filepath"
 	"regexp"
 	"strings"
+	"sync"
 )
 
+// Regexes used by the log diagnosis checks. They are compiled together the
+// first time a log is diagnosed, so a batch of failed apps only pays the
+// compilation cost once per process.
+var (
+	logDiagnoseRegexOnce sync.Once
+
+	regexSyncError              *regexp.Regexp
+	regexRepoNotFound           *regexp.Regexp
+	regexSignatureError         *regexp.Regexp
+	regexLockError              *regexp.Regexp
+	regexConflictError          *regexp.Regexp
+	regexDependencyError        *regexp.Regexp
+	regexPackageNotFound        *regexp.Regexp
+	regexBrokenPackage          *regexp.Regexp
+	regexAurReplacement         *regexp.Regexp
+	regexDkmsFailure            *regexp.Regexp
+	regexPartialUpgrade         *regexp.Regexp
+	regexCorruptedDb            *regexp.Regexp
+	regexDiskSpace              *regexp.Regexp
+	regexDependencyConflict     *regexp.Regexp
+	regexInternetError          *regexp.Regexp
+	regexFetchPack              *regexp.Regexp
+	regexFatalObject            *regexp.Regexp
+	regexRemoteEndHungUp        *regexp.Regexp
+	regexSslError               *regexp.Regexp
+	regexCurlError              *regexp.Regexp
+	regexAuthorizationFailed    *regexp.Regexp
+	regexFlathubError           *regexp.Regexp
+	regexTlsError               *regexp.Regexp
+	regexGnuTlsError            *regexp.Regexp
+	regexConnectException       *regexp.Regexp
+	regexCrateNotFound          *regexp.Regexp
+	regexCargoNetwork           *regexp.Regexp
+	regexHashDoesNotMatch       *regexp.Regexp
+	regexModuleNotFound         *regexp.Regexp
+	regexAppmenuGtkModule       *regexp.Regexp
+	regexDBus                   *regexp.Regexp
+	regexI18n                   *regexp.Regexp
+	regexSudoers                *regexp.Regexp
+	regexIncorrectPassword      *regexp.Regexp
+	regexSudoHost               *regexp.Regexp
+	regexCpp                    *regexp.Regexp
+	regexTar                    *regexp.Regexp
+	regexXz                     *regexp.Regexp
+	regexAria2c                 *regexp.Regexp
+	regexPermissionDenied       *regexp.Regexp
+	regexStructureNeedsCleaning *regexp.Regexp
+	regexVCHI                   *regexp.Regexp
+	regexFlatpak                *regexp.Regexp
+	regexSpace                  *regexp.Regexp
+	regexAutostart              *regexp.Regexp
+	regexCache                  *regexp.Regexp
+	regexMkdir                  *regexp.Regexp
+	regexSegfault               *regexp.Regexp
+	regexLsb                    *regexp.Regexp
+	regexKilled                 *regexp.Regexp
+	regexRustKilled             *regexp.Regexp
+	regexSnapd                  *regexp.Regexp
+	regexVeraCrypt              *regexp.Regexp
+	regexMount                  *regexp.Regexp
+	regexRustVersion            *regexp.Regexp
+	regexCargoPermission        *regexp.Regexp
+	regexRustOOM                *regexp.Regexp
+	regexRustTarget             *regexp.Regexp
+	regexUserError              *regexp.Regexp
+	regexUserErrorAllowed       *regexp.Regexp
+)
+
+// compileLogDiagnoseRegexes compiles the diagnosis pattern table on first use
+func compileLogDiagnoseRegexes() {
+	logDiagnoseRegexOnce.Do(func() {
+		regexSyncError = regexp.MustCompile(`error: failed to synchronize all databases|error: failed retrieving file.*from|error: failed to update|error: failed to download`)
+		regexRepoNotFound = regexp.MustCompile(`error:.*repository.*not found|error:.*404.*Not Found|error:.*failed to retrieve.*404`)
+		regexSignatureError = regexp.MustCompile(`error:.*signature from.*is unknown trust|error:.*signature.*is invalid|error:.*key.*is unknown|error:.*required signature missing`)
+		regexLockError = regexp.MustCompile(`error:.*failed to lock database|error:.*could not lock database|error:.*database.*locked`)
+		regexConflictError = regexp.MustCompile(`error: failed to commit transaction.*conflicting files|error:.*conflicts with|error:.*file conflicts`)
+		regexDependencyError = regexp.MustCompile(`error: failed to prepare transaction.*could not satisfy dependencies|error:.*unresolvable package conflicts|error:.*dependency.*not found|error:.*failed to prepare transaction.*conflicts`)
+		regexPackageNotFound = regexp.MustCompile(`error:.*package.*not found|error:.*target not found|error:.*no package found`)
+		regexBrokenPackage = regexp.MustCompile(`error:.*broken|error:.*unresolvable|error:.*invalid package`)
+		regexAurReplacement = regexp.MustCompile(`warning:.*is being replaced by.*-aur|warning:.*replacing.*with.*from.*aur|nvidia.*moved to.*aur|package.*moved to.*aur|nvidia.*moved to.*AUR`)
+		regexDkmsFailure = regexp.MustCompile(`error:.*dkms.*failed|error:.*kernel.*module.*failed|error:.*make.*failed.*dkms`)
+		regexPartialUpgrade = regexp.MustCompile(`warning:.*partial upgrade|error:.*partial upgrade`)
+		regexCorruptedDb = regexp.MustCompile(`error:.*database.*corrupt|error:.*invalid.*database|error:.*failed to read.*database`)
+		regexDiskSpace = regexp.MustCompile(`error:.*not enough.*space|error:.*insufficient.*space|error:.*failed.*extract.*space`)
+		regexDependencyConflict = regexp.MustCompile(`error: failed to select a version for the requirement.*version conflict`)
+		regexInternetError = regexp.MustCompile(`Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out`)
+		regexFetchPack = regexp.MustCompile(`fetch-pack: unexpected disconnect while reading sideband packet`)
+		regexFatalObject = regexp.MustCompile(`fatal: did not receive expected object`)
+		regexRemoteEndHungUp = regexp.MustCompile(`fatal: the remote end hung up unexpectedly`)
+		regexSslError = regexp.MustCompile(`SSL/TLS handshake failure\|total length mismatch\|failed to establish connection\|timeout\|connection reset by peer\|name resolution failed\|temporary failure in name resolution\|unable to establish SSL connection\|connection closed at byte\|read error at byte\|failed: No route to host\|invalid range header\|curl error\|response status not successful\|download snap\|dial tcp\|lookup api\.snapcraft\.io\|fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server\|RPC failed; curl .* transfer closed with outstanding read data remaining\|RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received.\|SSL error\|failure when receiving data from the peer\|java\.net\.SocketTimeoutException: Read timed out`)
+		regexCurlError = regexp.MustCompile(`curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)`)
+		regexAuthorizationFailed = regexp.MustCompile(`errorCode=24 Authorization failed.`)
+		regexFlathubError = regexp.MustCompile(`flathub: Error resolving .dl\.flathub\.org.`)
+		regexTlsError = regexp.MustCompile(`The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate`)
+		regexGnuTlsError = regexp.MustCompile(`GnuTLS recv error (-54): Error in the pull function.`)
+		regexConnectException = regexp.MustCompile(`java\.net\.ConnectException: Connection refused`)
+		regexCrateNotFound = regexp.MustCompile(`error: failed to get .*? as a dependency.*no matching package named`)
+		regexCargoNetwork = regexp.MustCompile(`error: failed to fetch from.*could not connect to server|error: failed to fetch.*Network is unreachable`)
+		regexHashDoesNotMatch = regexp.MustCompile(`ERROR: Downloaded system image hash doesn't match, expected`)
+		regexModuleNotFound = regexp.MustCompile(`modprobe: FATAL: Module .* not found in directory`)
+		regexAppmenuGtkModule = regexp.MustCompile(`Failed to load module "appmenu-gtk-module"`)
+		regexDBus = regexp.MustCompile(`error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down`)
+		regexI18n = regexp.MustCompile(`cat: /usr/share/i18n/SUPPORTED: No such file or directory`)
+		regexSudoers = regexp.MustCompile(`is not in the sudoers file.  This incident will be reported.`)
+		regexIncorrectPassword = regexp.MustCompile(`sudo: .* incorrect password attempts`)
+		regexSudoHost = regexp.MustCompile(`sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting`)
+		regexCpp = regexp.MustCompile(`cpp.o: file not recognized: file truncated`)
+		regexTar = regexp.MustCompile(`tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;`)
+		regexXz = regexp.MustCompile(`xz: Cannot exec: No such file or directory`)
+		regexAria2c = regexp.MustCompile(`aria2c: error while loading shared libraries`)
+		regexPermissionDenied = regexp.MustCompile(`errorCode=16 Failed to open the file .*, cause: Permission denied`)
+		regexStructureNeedsCleaning = regexp.MustCompile(`Structure needs cleaning`)
+		regexVCHI = regexp.MustCompile(`VCHI initialization failed`)
+		regexFlatpak = regexp.MustCompile(`Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object`)
+		regexSpace = regexp.MustCompile(`No space left on device\|Not enough disk space to complete this operation\|You don't have enough free space in\|Cannot write to .* (Success)\.`)
+		regexAutostart = regexp.MustCompile(`: line .*: \$HOME/\.config/autostart/.*\.desktop: Permission denied`)
+		regexCache = regexp.MustCompile(`The directory '(\$HOME|\$\{HOME\}|/home/[^/]+)/\.cache/pip' or its parent directory is not owned by the current user`)
+		regexMkdir = regexp.MustCompile(`mkdir: cannot create directory .*/home/[^/]+/pi-apps-.*: Permission denied|rm: cannot remove .*/home/[^/]+/.*: Permission denied`)
+		regexSegfault = regexp.MustCompile(`collect2: fatal error: ld terminated with signal 11 \[Segmentation fault\]`)
+		regexLsb = regexp.MustCompile(`ModuleNotFoundError: No module named 'lsb_release'|lsb_release: command not found`)
+		regexKilled = regexp.MustCompile(`c\+\+: fatal error: Killed signal terminated program cc1plus`)
+		regexRustKilled = regexp.MustCompile(`process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)`)
+		regexSnapd = regexp.MustCompile(`error: system does not fully support snapd: cannot mount squashfs image`)
+		regexVeraCrypt = regexp.MustCompile(`Error: All VeraCrypt volumes must be dismounted first.`)
+		regexMount = regexp.MustCompile(`Failed to mount squashfs image`)
+		regexRustVersion = regexp.MustCompile(`error: the current.*rustc .* is older than the minimum version required`)
+		regexCargoPermission = regexp.MustCompile(`failed to get metadata for.*: permission denied: .*\.cargo`)
+		regexRustOOM = regexp.MustCompile(`(LLVM ERROR: out of memory|rustc.*internal compiler error.*out of memory|killed by the OOM killer)`)
+		regexRustTarget = regexp.MustCompile(`error: failed to run custom build command for.*cross-compil|error: failed to run rustc to learn about target-specific information`)
+		regexUserError = regexp.MustCompile(`(?m)^User error: `)
+		regexUserErrorAllowed = regexp.MustCompile(`(?m)^User error \(reporting allowed\): `)
+	})
+}
+
 // LogDiagnose analyzes a logfile and returns diagnostic information
 //
 // It takes a logfile path and an allowWrite parameter
@@ -37,6 +172,8 @@ import (
 //	ErrorDiagnosis - the error diagnosis
 //	error - error if logfile is not specified
 func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
+	compileLogDiagnoseRegexes()
+
 	// Read the logfile
 	content, err := os.ReadFile(logfilePath)
 	if err != nil {
@@ -66,7 +203,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	//------------------------------------------
 
 	// Check for repository sync errors
-	regexSyncError := regexp.MustCompile(`error: failed to synchronize all databases|error: failed retrieving file.*from|error: failed to update|error: failed to download`)
 	if regexSyncError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Pacman failed to synchronize package databases.\n\n"+
@@ -80,7 +216,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for repository not found or 404 errors
-	regexRepoNotFound := regexp.MustCompile(`error:.*repository.*not found|error:.*404.*Not Found|error:.*failed to retrieve.*404`)
 	if regexRepoNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Pacman reported a repository that could not be found.\n\n"+
@@ -93,7 +228,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for signature/key errors
-	regexSignatureError := regexp.MustCompile(`error:.*signature from.*is unknown trust|error:.*signature.*is invalid|error:.*key.*is unknown|error:.*required signature missing`)
 	if regexSignatureError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Pacman reported a signature verification error.\n\n"+
@@ -106,7 +240,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for database lock errors
-	regexLockError := regexp.MustCompile(`error:.*failed to lock database|error:.*could not lock database|error:.*database.*locked`)
 	if regexLockError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Pacman database is locked, likely because another pacman process is running.\n\n"+
@@ -121,7 +254,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	//------------------------------------------
 
 	// Check for package conflicts
-	regexConflictError := regexp.MustCompile(`error: failed to commit transaction.*conflicting files|error:.*conflicts with|error:.*file conflicts`)
 	if regexConflictError.MatchString(errors) {
 		// Try to extract package names from the error
 		re := regexp.MustCompile(`error: failed to commit transaction.*conflicting files.*?:\s*(.*?)\n`)
@@ -144,7 +276,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for missing dependencies
-	regexDependencyError := regexp.MustCompile(`error: failed to prepare transaction.*could not satisfy dependencies|error:.*unresolvable package conflicts|error:.*dependency.*not found|error:.*failed to prepare transaction.*conflicts`)
 	if regexDependencyError.MatchString(errors) {
 		// Try to extract the missing package
 		re := regexp.MustCompile(`error:.*could not satisfy dependencies.*?:\s*(.*?)\n|error:.*dependency.*?:\s*(.*?)\s+not found`)
@@ -206,7 +337,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for package not found
-	regexPackageNotFound := regexp.MustCompile(`error:.*package.*not found|error:.*target not found|error:.*no package found`)
 	if regexPackageNotFound.MatchString(errors) {
 		// Try to extract package name
 		re := regexp.MustCompile(`error:.*package ['"]?([^'"]+)['"]?.*not found|error:.*target ['"]?([^'"]+)['"]?.*not found`)
@@ -269,7 +399,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for broken packages or partial upgrades
-	regexBrokenPackage := regexp.MustCompile(`error:.*broken|error:.*unresolvable|error:.*invalid package`)
 	if regexBrokenPackage.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Pacman reported broken or invalid packages.\n\n"+
@@ -282,7 +411,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for AUR package replacing system package (like NVIDIA drivers)
-	regexAurReplacement := regexp.MustCompile(`warning:.*is being replaced by.*-aur|warning:.*replacing.*with.*from.*aur|nvidia.*moved to.*aur|package.*moved to.*aur|nvidia.*moved to.*AUR`)
 	if regexAurReplacement.MatchString(errors) {
 		// Try to extract package names
 		re := regexp.MustCompile(`(nvidia[^\s]*).*?(nvidia[^\s]*-xx-dkms|nvidia[^\s]*-aur)`)
@@ -313,7 +441,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for DKMS kernel module compilation failures (common on Arch)
-	regexDkmsFailure := regexp.MustCompile(`error:.*dkms.*failed|error:.*kernel.*module.*failed|error:.*make.*failed.*dkms`)
 	if regexDkmsFailure.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"A kernel module (DKMS) failed to compile.\n\n"+
@@ -328,7 +455,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for partial upgrade warnings
-	regexPartialUpgrade := regexp.MustCompile(`warning:.*partial upgrade|error:.*partial upgrade`)
 	if regexPartialUpgrade.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Pacman detected a partial upgrade, which can cause dependency issues.\n\n"+
@@ -341,7 +467,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for corrupted package database
-	regexCorruptedDb := regexp.MustCompile(`error:.*database.*corrupt|error:.*invalid.*database|error:.*failed to read.*database`)
 	if regexCorruptedDb.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Pacman database appears to be corrupted.\n\n"+
@@ -355,7 +480,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for insufficient disk space during package installation
-	regexDiskSpace := regexp.MustCompile(`error:.*not enough.*space|error:.*insufficient.*space|error:.*failed.*extract.*space`)
 	if regexDiskSpace.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Pacman failed due to insufficient disk space.\n\n"+
@@ -372,7 +496,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// cargo package errors below
 
 	// Check for incompatible dependencies
-	regexDependencyConflict := regexp.MustCompile(`error: failed to select a version for the requirement.*version conflict`)
 	if regexDependencyConflict.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed due to conflicting dependency requirements.\n\n"+
@@ -384,7 +507,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// internet errors below
 
 	// check for "Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out" aka internet errors
-	regexInternetError := regexp.MustCompile(`Could not resolve host: github\.com\|Failed to connect to github\.com port 443: Connection timed out`)
 	if regexInternetError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to connect to github.com.\n\n"+
@@ -393,7 +515,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fetch-pack: unexpected disconnect while reading sideband packet" aka git errors
-	regexFetchPack := regexp.MustCompile(`fetch-pack: unexpected disconnect while reading sideband packet`)
 	if regexFetchPack.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fetch-pack: unexpected disconnect while reading sideband packet\" Check the stability of your Internet connection and try again. \n\n"+
@@ -402,7 +523,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fatal: did not receive expected object" aka git errors
-	regexFatalObject := regexp.MustCompile(`fatal: did not receive expected object`)
 	if regexFatalObject.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fatal: did not receive expected object\" Check the stability of your Internet connection and try again.\n\n"+
@@ -411,7 +531,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "fatal: the remote end hung up unexpectedly" aka git errors
-	regexRemoteEndHungUp := regexp.MustCompile(`fatal: the remote end hung up unexpectedly`)
 	if regexRemoteEndHungUp.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"fatal: the remote end hung up unexpectedly\" Check the stability of your Internet connection and try again.\n\n"+
@@ -420,7 +539,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for SSL/TLS handshake failure, total length mismatch, failed to establish connection, timeout, connection reset by peer, name resolution failed, temporary failure in name resolution, unable to establish SSL connection, connection closed at byte, read error at byte, failed: No route to host, invalid range header, curl error, response status not successful, download snap, dial tcp, lookup api.snapcraft.io, fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server, RPC failed; curl .* transfer closed with outstanding read data remaining, RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received., SSL error, failure when receiving data from the peer, java.net.SocketTimeoutException: Read timed out which include git errors
-	regexSslError := regexp.MustCompile(`SSL/TLS handshake failure\|total length mismatch\|failed to establish connection\|timeout\|connection reset by peer\|name resolution failed\|temporary failure in name resolution\|unable to establish SSL connection\|connection closed at byte\|read error at byte\|failed: No route to host\|invalid range header\|curl error\|response status not successful\|download snap\|dial tcp\|lookup api\.snapcraft\.io\|fatal: unable to access 'https://github.com.*': Failed to connect to github.com port 443 after .* ms: Couldn't connect to server\|RPC failed; curl .* transfer closed with outstanding read data remaining\|RPC failed; curl .* GnuTLS recv error (-9): A TLS packet with unexpected length was received.\|SSL error\|failure when receiving data from the peer\|java\.net\.SocketTimeoutException: Read timed out`)
 	if regexSslError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The git command encountered this error: \"SSL/TLS handshake failure\" Check the stability of your Internet connection and try again.")
@@ -428,7 +546,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)"
-	regexCurlError := regexp.MustCompile(`curl: (.*) HTTP/2 stream .* was not closed cleanly: INTERNAL_ERROR (err .*)`)
 	if regexCurlError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed due to an internal curl error. This could be an internet issue or hardware problem. \n"+
@@ -437,7 +554,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "errorCode=24 Authorization failed."
-	regexAuthorizationFailed := regexp.MustCompile(`errorCode=24 Authorization failed.`)
 	if regexAuthorizationFailed.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The curl command encountered this error: \"errorCode=24 Authorization failed.\" Check the stability of your Internet connection and try again.")
@@ -445,7 +561,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "flathub: Error resolving .dl\.flathub\.org."
-	regexFlathubError := regexp.MustCompile(`flathub: Error resolving .dl\.flathub\.org.`)
 	if regexFlathubError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The flathub command encountered this error: \"flathub: Error resolving .dl.flathub.org.\" Check the stability of your Internet connection and try again.")
@@ -453,7 +568,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate"
-	regexTlsError := regexp.MustCompile(`The TLS connection was non-properly terminated\.\|Can't load uri .* Unacceptable TLS certificate`)
 	if regexTlsError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"The TLS connection was non-properly terminated. Check the stability of your Internet connection and try again.")
@@ -461,7 +575,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for "GnuTLS recv error (-54): Error in the pull function."
-	regexGnuTlsError := regexp.MustCompile(`GnuTLS recv error (-54): Error in the pull function.`)
 	if regexGnuTlsError.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed due to an issue with your internet, not Pi-Apps. The connection was terminated before the download completed. \n\n"+
@@ -471,7 +584,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "java.net.ConnectException: Connection refused"
-	regexConnectException := regexp.MustCompile(`java\.net\.ConnectException: Connection refused`)
 	if regexConnectException.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed. Check your internet connection and firewall, then try again.")
@@ -479,7 +591,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cargo crate not found error
-	regexCrateNotFound := regexp.MustCompile(`error: failed to get .*? as a dependency.*no matching package named`)
 	if regexCrateNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because a required crate dependency was not found.\n\n"+
@@ -492,7 +603,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for cargo network errors
-	regexCargoNetwork := regexp.MustCompile(`error: failed to fetch from.*could not connect to server|error: failed to fetch.*Network is unreachable`)
 	if regexCargoNetwork.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Cargo couldn't connect to the crates.io registry or other dependency sources.\n\n"+
@@ -501,7 +611,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for ERROR: Downloaded system image hash doesn't match, expected <hash> from Waydroid
-	regexHashDoesNotMatch := regexp.MustCompile(`ERROR: Downloaded system image hash doesn't match, expected`)
 	if regexHashDoesNotMatch.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Waydroid OS image download failed. Check your internet connection and firewall, then try again.")
@@ -511,7 +620,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// other system errors below
 
 	// check for modprobe: FATAL: Module .* not found in directory
-	regexModuleNotFound := regexp.MustCompile(`modprobe: FATAL: Module .* not found in directory`)
 	if regexModuleNotFound.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with the kernel modules. Try rebooting if your kernel was upgraded. \n\n"+
@@ -522,7 +630,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Failed to load module \"appmenu-gtk-module\""
-	regexAppmenuGtkModule := regexp.MustCompile(`Failed to load module "appmenu-gtk-module"`)
 	if regexAppmenuGtkModule.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"This error occurred: Failed to load module \"appmenu-gtk-module\" \n\n"+
@@ -533,7 +640,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down"
-	regexDBus := regexp.MustCompile(`error: Unable to connect to system bus\|error: Message recipient disconnected from message bus without replying\|Failed to connect to bus: Host is down`)
 	if regexDBus.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Something is wrong with your dbus connection. \n\n"+
@@ -546,7 +652,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "cat: /usr/share/i18n/SUPPORTED: No such file or directory"
-	regexI18n := regexp.MustCompile(`cat: /usr/share/i18n/SUPPORTED: No such file or directory`)
 	if regexI18n.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your system is missing the /usr/share/i18n/SUPPORTED file. \n\n"+
@@ -556,7 +661,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "is not in the sudoers file.  This incident will be reported."
-	regexSudoers := regexp.MustCompile(`is not in the sudoers file.  This incident will be reported.`)
 	if regexSudoers.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -571,7 +675,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "sudo: .* incorrect password attempts"
-	regexIncorrectPassword := regexp.MustCompile(`sudo: .* incorrect password attempts`)
 	if regexIncorrectPassword.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because you failed to type in the correct sudo password. \n\n"+
@@ -580,7 +683,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting"
-	regexSudoHost := regexp.MustCompile(`sudo: unable to resolve host\|sudo: no valid sudoers sources found, quitting`)
 	if regexSudoHost.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Process could not complete because your sudo command is incorrectly set up. \n\n"+
@@ -589,7 +691,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "cpp.o: file not recognized: file truncated"
-	regexCpp := regexp.MustCompile(`cpp.o: file not recognized: file truncated`)
 	if regexCpp.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed. Try again, but please reach out to Pi-Apps developers for help if this same error keeps occurring.")
@@ -597,7 +698,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;"
-	regexTar := regexp.MustCompile(`tar: Unexpected EOF in archive\|xz: (stdin): Unexpected end of input\|xz: (stdin): Compressed data is corrupt\|xz: (stdin): File format not recognized\|gzip: stdin: invalid compressed data\-\-length error\|gzip: stdin: invalid compressed data\-\-crc error\|corrupted filesystem tarfile in package archive: invalid tar header size field (Invalid argument)\|member 'data.tar': internal gzip read error: '<fd:4>: incorrect data check\|error inflating zlib stream;`)
 	if regexTar.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Extraction failed. Most likely this was a corrupted download, so please try again. \n\n"+
@@ -606,7 +706,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "xz: Cannot exec: No such file or directory"
-	regexXz := regexp.MustCompile(`xz: Cannot exec: No such file or directory`)
 	if regexXz.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Extraction failed because XZ is not installed. \n\n"+
@@ -616,7 +715,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "aria2c: error while loading shared libraries"
-	regexAria2c := regexp.MustCompile(`aria2c: error while loading shared libraries`)
 	if regexAria2c.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Download failed because aria2c could not load required libraries. \n\n"+
@@ -626,7 +724,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "errorCode=16 Failed to open the file .*, cause: Permission denied"
-	regexPermissionDenied := regexp.MustCompile(`errorCode=16 Failed to open the file .*, cause: Permission denied`)
 	if regexPermissionDenied.MatchString(errors) {
 		// Extract the file path from the error message
 		re := regexp.MustCompile(`errorCode=16 Failed to open the file (.*), cause: Permission denied`)
@@ -646,7 +743,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Structure needs cleaning"
-	regexStructureNeedsCleaning := regexp.MustCompile(`Structure needs cleaning`)
 	if regexStructureNeedsCleaning.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your have encountered the dreaded \"Structure needs cleaning\" error. This indicates file-corruption caused by improperly shutting down your computer. You are lucky your computer booted at all.\n\n"+
@@ -658,7 +754,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "VCHI initialization failed"
-	regexVCHI := regexp.MustCompile(`VCHI initialization failed`)
 	if regexVCHI.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -674,7 +769,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object"
-	regexFlatpak := regexp.MustCompile(`Error: Failed to read commit .* No such metadata object\|error: Failed to install org.freedesktop.Platform: Failed to read commit .* No such metadata object\|Error: Error deploying: .* No such metadata object`)
 	if regexFlatpak.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Flatpak failed to install something due to a past incompleted download. \n\n"+
@@ -685,7 +779,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "No space left on device"
-	regexSpace := regexp.MustCompile(`No space left on device\|Not enough disk space to complete this operation\|You don't have enough free space in\|Cannot write to .* (Success)\.`)
 	if regexSpace.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your system has insufficient disk space.\n\n"+
@@ -694,7 +787,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for permission denied when creating autostart entries
-	regexAutostart := regexp.MustCompile(`: line .*: \$HOME/\.config/autostart/.*\.desktop: Permission denied`)
 	if regexAutostart.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -711,7 +803,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "The directory '$HOME/\.cache/pip' or its parent directory is not owned by the current user"
-	regexCache := regexp.MustCompile(`The directory '(\$HOME|\$\{HOME\}|/home/[^/]+)/\.cache/pip' or its parent directory is not owned by the current user`)
 	if regexCache.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -734,7 +825,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "mkdir: cannot create directory .*/home/username/pi-apps-.*: Permission denied"
-	regexMkdir := regexp.MustCompile(`mkdir: cannot create directory .*/home/[^/]+/pi-apps-.*: Permission denied|rm: cannot remove .*/home/[^/]+/.*: Permission denied`)
 	if regexMkdir.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -751,7 +841,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for segmentation fault from linker
-	regexSegfault := regexp.MustCompile(`collect2: fatal error: ld terminated with signal 11 \[Segmentation fault\]`)
 	if regexSegfault.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to compile! The error was: \"collect2: fatal error: ld terminated with signal 11 [Segmentation fault]\"\n\n"+
@@ -760,7 +849,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "No LSB modules are available" or lsb_release errors
-	regexLsb := regexp.MustCompile(`ModuleNotFoundError: No module named 'lsb_release'|lsb_release: command not found`)
 	if regexLsb.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Your lsb_release command is missing. On Arch Linux, install it with: \n"+
@@ -770,7 +858,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "c++: fatal error: Killed signal terminated program cc1plus"
-	regexKilled := regexp.MustCompile(`c\+\+: fatal error: Killed signal terminated program cc1plus`)
 	if regexKilled.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed because cc1plus was killed due to insufficient RAM.\n\n"+
@@ -780,7 +867,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)"
-	regexRustKilled := regexp.MustCompile(`process didn't exit successfully: .*/rustc .* (signal: 9, SIGKILL: kill)`)
 	if regexRustKilled.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Compiling failed because rustc was killed due to insufficient RAM.\n"+
@@ -790,7 +876,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for error: system does not fully support snapd: cannot mount squashfs image
-	regexSnapd := regexp.MustCompile(`error: system does not fully support snapd: cannot mount squashfs image`)
 	if regexSnapd.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Snap failed to fully install due to this error: 'error: system does not fully support snapd: cannot mount squashfs image'\n\n"+
@@ -799,7 +884,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Error: All VeraCrypt volumes must be dismounted first."
-	regexVeraCrypt := regexp.MustCompile(`Error: All VeraCrypt volumes must be dismounted first.`)
 	if regexVeraCrypt.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Error encountered: 'Error: All VeraCrypt volumes must be dismounted first.'\n\n"+
@@ -808,7 +892,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// check for "Failed to mount squashfs image"
-	regexMount := regexp.MustCompile(`Failed to mount squashfs image`)
 	if regexMount.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Failed to mount squashfs image. This is most likely due to a failed installation of a package. Try reinstalling the package.")
@@ -816,7 +899,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for Rust version mismatch
-	regexRustVersion := regexp.MustCompile(`error: the current.*rustc .* is older than the minimum version required`)
 	if regexRustVersion.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because your Rust compiler (rustc) is too old for this project.\n\n"+
@@ -826,7 +908,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for permission issues with .cargo directory
-	regexCargoPermission := regexp.MustCompile(`failed to get metadata for.*: permission denied: .*\.cargo`)
 	if regexCargoPermission.MatchString(errors) {
 		// Get current user
 		currentUser := os.Getenv("USER")
@@ -848,7 +929,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for out of memory during Rust compilation
-	regexRustOOM := regexp.MustCompile(`(LLVM ERROR: out of memory|rustc.*internal compiler error.*out of memory|killed by the OOM killer)`)
 	if regexRustOOM.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed because the system ran out of memory.\n\n"+
@@ -861,7 +941,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// Check for target architecture issues
-	regexRustTarget := regexp.MustCompile(`error: failed to run custom build command for.*cross-compil|error: failed to run rustc to learn about target-specific information`)
 	if regexRustTarget.MatchString(errors) {
 		diagnosis.Captions = append(diagnosis.Captions,
 			"Rust compilation failed due to cross-compilation or target architecture issues.\n\n"+
@@ -875,7 +954,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	// Check for user errors - these are errors that scripts deliberately output to diagnose issues
 
 	// Regular user error (reporting blocked)
-	regexUserError := regexp.MustCompile(`(?m)^User error: `)
 	if regexUserError.MatchString(errors) {
 		// Extract the error message - get only the lines that are part of the actual error
 		scanner := bufio.NewScanner(strings.NewReader(errors))
@@ -907,7 +985,6 @@ func LogDiagnose(logfilePath string, allowWrite bool) (*ErrorDiagnosis, error) {
 	}
 
 	// User error with reporting allowed
-	regexUserErrorAllowed := regexp.MustCompile(`(?m)^User error \(reporting allowed\): `)
 	if regexUserErrorAllowed.MatchString(errors) {
 		// Extract the error message - get only the lines that are part of the actual error
 		scanner := bufio.NewScanner(strings.NewReader(errors))
@@ -0,0 +1,104 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: log_pipeline.go
+// Description: Asynchronous buffered writer for install/uninstall log files.
+// Script output is queued in memory and persisted by a dedicated goroutine
+// doing large coalesced writes, so a chatty script (or the terminal display
+// sharing its MultiWriter) never stalls on a slow SD-card log write.
+// Producers only block when the queue is genuinely full.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import "io"
+
+const (
+	// logQueueDepth is how many pending output chunks may be queued before
+	// Write starts applying backpressure
+	logQueueDepth = 512
+
+	// logCoalesceLimit caps how much queued output is merged into a single
+	// write to the underlying file
+	logCoalesceLimit = 64 * 1024
+)
+
+// asyncLogWriter decouples producers of log output from the log file. Write
+// only copies the chunk onto a queue; a dedicated goroutine drains the queue,
+// merging everything already waiting so a slow disk sees a few large writes
+// instead of one syscall per output line.
+type asyncLogWriter struct {
+	chunks chan []byte
+	done   chan struct{}
+	err    error // first write error, reported by Close
+}
+
+// newAsyncLogWriter starts the writer goroutine persisting to w. The caller
+// must call Close exactly once to drain the queue and collect any write error.
+func newAsyncLogWriter(w io.Writer) *asyncLogWriter {
+	l := &asyncLogWriter{
+		chunks: make(chan []byte, logQueueDepth),
+		done:   make(chan struct{}),
+	}
+	go l.run(w)
+	return l
+}
+
+// Write queues a copy of p for persistence. It blocks only when logQueueDepth
+// chunks are already waiting; errors from the file surface on Close.
+func (l *asyncLogWriter) Write(p []byte) (int, error) {
+	chunk := make([]byte, len(p))
+	copy(chunk, p)
+	l.chunks <- chunk
+	return len(p), nil
+}
+
+// run persists queued chunks. Each pass gathers whatever has accumulated up
+// to logCoalesceLimit into one write, then flushes immediately — output is
+// never held back waiting for more, so the file stays current.
+func (l *asyncLogWriter) run(w io.Writer) {
+	defer close(l.done)
+	buf := make([]byte, 0, logCoalesceLimit)
+	for chunk := range l.chunks {
+		buf = append(buf[:0], chunk...)
+	gather:
+		for len(buf) < logCoalesceLimit {
+			select {
+			case more, ok := <-l.chunks:
+				if !ok {
+					break gather
+				}
+				buf = append(buf, more...)
+			default:
+				break gather
+			}
+		}
+		if l.err == nil {
+			if _, err := w.Write(buf); err != nil {
+				l.err = err
+			}
+		}
+	}
+}
+
+// Close drains everything still queued, stops the writer goroutine and
+// returns the first error the underlying file reported. After Close the
+// caller may safely write to the file directly again.
+func (l *asyncLogWriter) Close() error {
+	close(l.chunks)
+	<-l.done
+	return l.err
+}
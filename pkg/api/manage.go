@@ -28,7 +28,6 @@ import (
 	"os/exec"
 	"os/user"
 	"path/filepath"
-	"regexp"
 	"runtime"
 	"strconv"
 	"strings"
@@ -51,32 +50,10 @@ const (
 	ActionRefresh   Action = "refresh"
 )
 
-// AnsiStripWriter wraps an io.Writer and strips ANSI escape sequences before writing
-type AnsiStripWriter struct {
-	writer io.Writer
-	ansiRe *regexp.Regexp
-}
-
-// NewAnsiStripWriter creates a new AnsiStripWriter
-func NewAnsiStripWriter(w io.Writer) *AnsiStripWriter {
-	return &AnsiStripWriter{
-		writer: w,
-		ansiRe: regexp.MustCompile(`\x1b\[?[0-9;]*[a-zA-Z]`),
-	}
-}
-
-// Write implements io.Writer interface, stripping ANSI codes before writing
-func (w *AnsiStripWriter) Write(p []byte) (n int, err error) {
-	// Strip ANSI escape sequences
-	cleaned := w.ansiRe.ReplaceAll(p, []byte{})
-	// Write the cleaned content to the underlying writer
-	_, err = w.writer.Write(cleaned)
-	// Return the original length to satisfy the io.Writer interface
-	return len(p), err
-}
-
 // ManageApp handles installation, uninstallation, or updating of an app
 func ManageApp(action Action, appName string, isUpdate bool) error {
+	defer TraceSpan(fmt.Sprintf("manage.%s %s", action, appName))()
+
 	// Get PI_APPS_DIR environment variable
 	piAppsDir := GetPiAppsDir()
 	if piAppsDir == "" {
@@ -115,7 +92,10 @@ func ManageApp(action Action, appName string, isUpdate bool) error {
 
 	// Check internet connection if installing
 	if action == ActionInstall {
-		if err := CheckInternetConnection(); err != nil {
+		endSpan := TraceSpan("manage.internet-check")
+		err := CheckInternetConnection()
+		endSpan()
+		if err != nil {
 			return fmt.Errorf("no internet connection: %w", err)
 		}
 	}
@@ -144,7 +124,9 @@ func ManageApp(action Action, appName string, isUpdate bool) error {
 	Status(fmt.Sprintf("%sing \033[1m%s\033[22m...", action, appName))
 
 	// Check if system is supported
+	endSpan := TraceSpan("manage.system-support-check")
 	supported, supportMessage := IsAppSupportedOnSystem(appName)
+	endSpan()
 	if !supported {
 		// Add ANSI color codes to match the original Bash implementation
 		warningPrefix := "\033[93m\033[5m◢◣\033[25m\033[0m \033[93mWARNING:\033[0m \033[93mYOUR SYSTEM IS UNSUPPORTED:\033[0m\n"
@@ -246,13 +228,17 @@ func ManageApp(action Action, appName string, isUpdate bool) error {
 
 			switch action {
 			case ActionInstall:
+				endSpan := TraceSpan("manage.install-packages")
 				err := installPackageAppDependencies(packages)
+				endSpan()
 				if err != nil {
 					return fmt.Errorf("failed to install package app: %w", err)
 				}
 				return nil
 			case ActionUninstall:
+				endSpan := TraceSpan("manage.uninstall-packages")
 				err := uninstallPackageAppDependencies(packages)
+				endSpan()
 				if err != nil {
 					return fmt.Errorf("failed to uninstall package app: %w", err)
 				}
@@ -272,18 +258,27 @@ func ManageApp(action Action, appName string, isUpdate bool) error {
 		_ = os.MkdirAll(filepath.Join(os.Getenv("HOME"), ".local", "share"), 0755)
 	}
 
-	// Create ANSI-stripping writer for log file to avoid escape codes in logs
-	ansiStripLogWriter := NewAnsiStripWriter(logFile)
+	// Persist log output asynchronously, with ANSI codes stripped, so the
+	// script is never stalled by slow log file writes
+	logWriter := newAsyncLogWriter(logFile)
+	ansiStripLogWriter := NewAnsiStripWriter(logWriter)
 	// Connect command output to log file with ANSI stripped
 	cmd.Stdout = ansiStripLogWriter
 	cmd.Stderr = ansiStripLogWriter
 
 	// Run the command (script apps need bash wrapper for helper functions)
+	endSpan = TraceSpan("manage.run-script")
 	if isScriptApp {
 		err = RunWithScriptWrappers(cmd)
 	} else {
 		err = cmd.Run()
 	}
+	endSpan()
+
+	// Drain queued log output before writing outcome messages directly
+	if flushErr := logWriter.Close(); flushErr != nil {
+		fmt.Printf("Warning: failed to write log file %s: %v\n", logPath, flushErr)
+	}
 
 	// Determine success or failure
 	if err != nil {
@@ -335,6 +330,8 @@ func ManageApp(action Action, appName string, isUpdate bool) error {
 	fmt.Fprintf(logFile, "\n%s %sed successfully.\n", action, appName)
 	StatusGreen(fmt.Sprintf("%s %sed successfully.", action, appName))
 
+	defer TraceSpan("manage.finalize-log")()
+
 	// Format the log file to add device information (consistent with bash version)
 	formatErr := FormatLogfile(logPath)
 	if formatErr != nil {
@@ -549,7 +546,14 @@ func SetAppStatus(appName, status string) error {
 	os.MkdirAll(statusDir, 0755)
 
 	statusFile := filepath.Join(statusDir, appName)
-	return os.WriteFile(statusFile, []byte(status), 0644)
+	if err := os.WriteFile(statusFile, []byte(status), 0644); err != nil {
+		return err
+	}
+
+	// Fold the change into the cached app-list index so the next list query
+	// revalidates instead of rebuilding the whole index
+	noteAppStatusChange(piAppsDir, appName, status)
+	return nil
 }
 
 // RefreshPackageAppStatus refreshes the status of a package-based app
@@ -676,12 +680,28 @@ func ValidateApps(action Action, appList []string) ([]string, error) {
 		return nil, fmt.Errorf("PI_APPS_DIR environment variable not set")
 	}
 
+	// Resolve existence against the shared app-list index when available —
+	// one index load instead of one stat call per app. Deprecated entries
+	// only exist under data/deprecated-apps, so they stay invalid here just
+	// as the directory check would report.
+	var index *appIndex
+	if idx, err := loadAppIndex(piAppsDir); err == nil {
+		index = idx
+	}
+
 	var validApps []string
 	for _, app := range appList {
-		appDir := filepath.Join(piAppsDir, "apps", app)
-		if _, err := os.Stat(appDir); os.IsNotExist(err) {
-			fmt.Printf("Invalid app '%s'. Cannot %s it.\n", app, action)
-			continue
+		if index != nil {
+			if entry, ok := index.byName[app]; !ok || entry.Flags&appIndexFlagDeprecated != 0 {
+				fmt.Printf("Invalid app '%s'. Cannot %s it.\n", app, action)
+				continue
+			}
+		} else {
+			appDir := filepath.Join(piAppsDir, "apps", app)
+			if _, err := os.Stat(appDir); os.IsNotExist(err) {
+				fmt.Printf("Invalid app '%s'. Cannot %s it.\n", app, action)
+				continue
+			}
 		}
 
 		// Additional validation could be added here
@@ -704,11 +724,17 @@ func MultiBatchOperation(action Action, appList []string) error {
 	}
 
 	failedApps := []string{}
-	for _, app := range validApps {
-		fmt.Printf("Processing %s: %s\n", action, app)
-		if err := ManageApp(action, app, false); err != nil {
-			fmt.Printf("Failed to %s %s: %v\n", action, app, err)
-			failedApps = append(failedApps, app)
+	if action == ActionInstall && len(validApps) > 1 {
+		// Install batches go through the scheduler so package downloads
+		// overlap the script-app installs
+		failedApps = runScheduledInstall(validApps)
+	} else {
+		for _, app := range validApps {
+			fmt.Printf("Processing %s: %s\n", action, app)
+			if err := ManageApp(action, app, false); err != nil {
+				fmt.Printf("Failed to %s %s: %v\n", action, app, err)
+				failedApps = append(failedApps, app)
+			}
 		}
 	}
 
@@ -953,8 +979,10 @@ cd "$HOME"
 		cmd = exec.Command(tempScriptPath)
 	}
 
-	// Create ANSI-stripping writer for log file to avoid escape codes in logs
-	ansiStripLogWriter := NewAnsiStripWriter(logFile)
+	// Persist log output asynchronously, with ANSI codes stripped, so the
+	// terminal display and the log file never stall each other
+	logWriter := newAsyncLogWriter(logFile)
+	ansiStripLogWriter := NewAnsiStripWriter(logWriter)
 	// Connect command output to both log file (with ANSI stripped) and stdout (with ANSI preserved)
 	multiWriter := io.MultiWriter(ansiStripLogWriter, os.Stdout)
 	cmd.Stdout = multiWriter
@@ -976,6 +1004,11 @@ cd "$HOME"
 	// Run the command
 	err = cmd.Run()
 
+	// Drain queued log output before writing outcome messages directly
+	if flushErr := logWriter.Close(); flushErr != nil {
+		fmt.Printf("Warning: failed to write log file %s: %v\n", logPath, flushErr)
+	}
+
 	// Determine success or failure
 	if err != nil {
 		// Write plain text to log file (no color codes)
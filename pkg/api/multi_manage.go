@@ -25,6 +25,7 @@ import (
 	"os"
 	"os/exec"
 	"path/filepath"
+	"sort"
 	"strings"
 
 	"github.com/gotk3/gotk3/gdk"
@@ -44,25 +45,33 @@ func MultiInstallGUI() error {
 		return fmt.Errorf("PI_APPS_DIR environment variable not set")
 	}
 
-	// Get list of apps to show in dialog
-	// Hide hidden apps and hide installed apps
-	installableApps, err := ListApps("cpu_installable")
-	if err != nil {
-		return fmt.Errorf("failed to get installable apps: %w", err)
-	}
+	// Get list of apps to show in dialog: installable on this CPU, not
+	// hidden, not installed. One pass over the shared app-list index covers
+	// all three conditions; the separate ListApps filters remain as the
+	// fallback when the index is unavailable.
+	var availableApps []string
+	if index, err := loadAppIndex(piAppsDir); err == nil {
+		availableApps = index.multiInstallCandidates(getSystemArchitecture())
+		sort.Strings(availableApps)
+	} else {
+		installableApps, err := ListApps("cpu_installable")
+		if err != nil {
+			return fmt.Errorf("failed to get installable apps: %w", err)
+		}
 
-	hiddenApps, err := ListApps("hidden")
-	if err != nil {
-		return fmt.Errorf("failed to get hidden apps: %w", err)
-	}
+		hiddenApps, err := ListApps("hidden")
+		if err != nil {
+			return fmt.Errorf("failed to get hidden apps: %w", err)
+		}
 
-	installedApps, err := ListApps("installed")
-	if err != nil {
-		return fmt.Errorf("failed to get installed apps: %w", err)
-	}
+		installedApps, err := ListApps("installed")
+		if err != nil {
+			return fmt.Errorf("failed to get installed apps: %w", err)
+		}
 
-	availableApps := ListSubtract(installableApps, hiddenApps)
-	availableApps = ListSubtract(availableApps, installedApps)
+		availableApps = ListSubtract(installableApps, hiddenApps)
+		availableApps = ListSubtract(availableApps, installedApps)
+	}
 
 	// If no apps are available, show a message
 	if len(availableApps) == 0 {
@@ -400,10 +409,17 @@ func MultiUninstallGUI() error {
 		return fmt.Errorf("PI_APPS_DIR environment variable not set")
 	}
 
-	// Get list of installed apps
-	installedApps, err := ListApps("installed")
-	if err != nil {
-		return fmt.Errorf("failed to get installed apps: %w", err)
+	// Get list of installed apps from one pass over the shared app-list
+	// index, falling back to the ListApps filter when it is unavailable
+	var installedApps []string
+	if index, err := loadAppIndex(piAppsDir); err == nil {
+		installedApps = index.appsWithStatus(true)
+		sort.Strings(installedApps)
+	} else {
+		installedApps, err = ListApps("installed")
+		if err != nil {
+			return fmt.Errorf("failed to get installed apps: %w", err)
+		}
 	}
 
 	// If no apps are installed, show a message
@@ -0,0 +1,129 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: multi_schedule.go
+// Description: Scheduler for multi-app installs. Package downloads for
+// queued package-apps are prefetched in the background while script apps
+// run, so only the package manager's lock section stays serialized and the
+// batch finishes in roughly the time of the longest download plus one
+// package transaction.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"fmt"
+	"strings"
+)
+
+// multiInstallNode is one scheduled app in a multi-install batch
+type multiInstallNode struct {
+	App      string
+	Type     string   // "standard", "package", or "flatpak_package"
+	Packages []string // required packages for package-apps
+}
+
+// buildMultiInstallPlan resolves each queued app's type and package
+// requirements so the scheduler knows what can be prefetched
+func buildMultiInstallPlan(apps []string) []multiInstallNode {
+	var plan []multiInstallNode
+	for _, app := range apps {
+		node := multiInstallNode{App: app}
+
+		appType, err := AppType(app)
+		if err != nil {
+			// Let ManageApp report the error in order; schedule it as a
+			// script app so it runs in the first stage
+			node.Type = "standard"
+			plan = append(plan, node)
+			continue
+		}
+		node.Type = appType
+
+		if appType == "package" {
+			if packages, err := PkgAppPackagesRequired(app); err == nil {
+				node.Packages = strings.Fields(packages)
+			}
+		}
+
+		plan = append(plan, node)
+	}
+	return plan
+}
+
+// runScheduledInstall installs a batch of apps with overlapped downloads:
+// every queued package-app's packages are downloaded in the background
+// while script and flatpak apps run (their installs do their own
+// downloading), then the package-apps are installed from the warm cache.
+// Returns the names of the apps that failed.
+func runScheduledInstall(validApps []string) []string {
+	plan := buildMultiInstallPlan(validApps)
+
+	// Kick off the background prefetch for all package-app packages
+	var prefetch []string
+	for _, node := range plan {
+		if node.Type == "package" {
+			prefetch = append(prefetch, node.Packages...)
+		}
+	}
+
+	prefetchDone := make(chan error, 1)
+	if len(prefetch) > 0 {
+		StatusT("Prefetching %d package(s) in the background...", len(prefetch))
+		go func() {
+			prefetchDone <- prefetchPackageAppDependencies(prefetch...)
+		}()
+	} else {
+		prefetchDone <- nil
+	}
+
+	var failedApps []string
+
+	// Stage 1: script and flatpak apps. Their own downloads overlap the
+	// package prefetch; any package-manager use inside the scripts is
+	// already serialized by the lock-wait helpers.
+	for _, node := range plan {
+		if node.Type == "package" {
+			continue
+		}
+		fmt.Printf("Processing install: %s\n", node.App)
+		if err := ManageApp(ActionInstall, node.App, false); err != nil {
+			fmt.Printf("Failed to install %s: %v\n", node.App, err)
+			failedApps = append(failedApps, node.App)
+		}
+	}
+
+	// Wait for the downloads before entering the serialized package
+	// transaction. A prefetch failure is not fatal - the install below
+	// simply downloads what's missing.
+	if err := <-prefetchDone; err != nil {
+		Debug(fmt.Sprintf("Package prefetch failed (continuing): %v", err))
+	}
+
+	// Stage 2: package apps, installed from the warm package cache
+	for _, node := range plan {
+		if node.Type != "package" {
+			continue
+		}
+		fmt.Printf("Processing install: %s\n", node.App)
+		if err := ManageApp(ActionInstall, node.App, false); err != nil {
+			fmt.Printf("Failed to install %s: %v\n", node.App, err)
+			failedApps = append(failedApps, node.App)
+		}
+	}
+
+	return failedApps
+}
@@ -0,0 +1,129 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: package_icon_cache.go
+// Description: Versioned cache for icons resolved from packages. The icon
+// hunt in GetIconFromPackage re-runs dependency and file-list queries on
+// every call; this cache copies the resolved icon under data/package-icons/
+// keyed by the package list and its installed versions, so reopening the
+// app-creation wizard short-circuits to the cached file until any of the
+// packages is upgraded.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+)
+
+// packageIconDirName is the cache directory under data/
+const packageIconDirName = "package-icons"
+
+// packageIconEntry records one resolved icon and the package versions it was
+// extracted from; a version change invalidates the entry
+type packageIconEntry struct {
+	Versions string `json:"versions"`
+	Icon     string `json:"icon"` // file name inside the cache directory
+}
+
+// packageIconIndex is the persisted index of cached icons, keyed by the
+// space-joined package list the icon was requested for
+type packageIconIndex struct {
+	Entries map[string]packageIconEntry `json:"entries"`
+}
+
+var packageIconMu sync.Mutex
+
+// packageIconIndexPath returns the path of the cache index file
+func packageIconIndexPath(directory string) string {
+	return filepath.Join(directory, "data", packageIconDirName, "index.json")
+}
+
+// loadPackageIconIndex reads the cache index, returning an empty index when
+// it is missing or unreadable
+func loadPackageIconIndex(directory string) *packageIconIndex {
+	index := &packageIconIndex{Entries: make(map[string]packageIconEntry)}
+	data, err := os.ReadFile(packageIconIndexPath(directory))
+	if err != nil {
+		return index
+	}
+	if err := json.Unmarshal(data, index); err != nil || index.Entries == nil {
+		return &packageIconIndex{Entries: make(map[string]packageIconEntry)}
+	}
+	return index
+}
+
+// lookupPackageIcon returns the cached icon for the given package list if it
+// was stored for the same installed versions and still exists on disk
+func lookupPackageIcon(directory, key, versions string) (string, bool) {
+	packageIconMu.Lock()
+	defer packageIconMu.Unlock()
+
+	entry, ok := loadPackageIconIndex(directory).Entries[key]
+	if !ok || entry.Versions != versions {
+		return "", false
+	}
+
+	iconPath := filepath.Join(directory, "data", packageIconDirName, entry.Icon)
+	if !FileExists(iconPath) {
+		return "", false
+	}
+	return iconPath, true
+}
+
+// storePackageIcon copies the resolved icon into the cache directory and
+// records it in the index, returning the path of the cached copy
+func storePackageIcon(directory, key, versions, iconPath string) (string, error) {
+	cacheDir := filepath.Join(directory, "data", packageIconDirName)
+	if err := os.MkdirAll(cacheDir, 0755); err != nil {
+		return "", err
+	}
+
+	// Name the copy after the first package, disambiguated by a hash of the
+	// request and versions so upgrades produce a fresh file
+	sum := sha256.Sum256([]byte(key + "\x00" + versions))
+	firstPkg := strings.Fields(key)[0]
+	iconName := firstPkg + "-" + hex.EncodeToString(sum[:8]) + filepath.Ext(iconPath)
+
+	cachedPath := filepath.Join(cacheDir, iconName)
+	if err := CopyFile(iconPath, cachedPath); err != nil {
+		return "", err
+	}
+
+	packageIconMu.Lock()
+	defer packageIconMu.Unlock()
+
+	index := loadPackageIconIndex(directory)
+	if old, ok := index.Entries[key]; ok && old.Icon != iconName {
+		os.Remove(filepath.Join(cacheDir, old.Icon))
+	}
+	index.Entries[key] = packageIconEntry{Versions: versions, Icon: iconName}
+
+	data, err := json.Marshal(index)
+	if err != nil {
+		return "", err
+	}
+	if err := os.WriteFile(packageIconIndexPath(directory), data, 0644); err != nil {
+		return "", err
+	}
+	return cachedPath, nil
+}
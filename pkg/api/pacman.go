@@ -33,7 +33,6 @@ import (
 	"os"
 	"os/exec"
 	"path/filepath"
-	"regexp"
 	"sort"
 	"strings"
 	"time"
@@ -325,10 +324,7 @@ func LessApt(input string) string {
 // stripAnsiCodes removes ANSI color and formatting codes from a string
 // This is useful for processing the output of commands like apt that might include color codes
 func stripAnsiCodes(s string) string {
-	// ANSI escape sequences typically start with ESC (0x1B) followed by '[' and then some sequence
-	// This regex matches all ANSI escape sequences used for colors and formatting
-	re := regexp.MustCompile(`\x1b\[[0-9;]*[a-zA-Z]`)
-	return re.ReplaceAllString(s, "")
+	return stripAnsiString(s)
 }
 
 // fetchGPGKeyFromKeyserver retrieves a GPG key from a keyserver using HTTP
@@ -1074,6 +1070,17 @@ func PurgePackages(app string, isUpdate bool) error {
 	return nil
 }
 
+// installedPackageVersions returns a fingerprint of the installed versions
+// of the given packages, "" when none of them is installed
+func installedPackageVersions(packages []string) string {
+	args := append([]string{"-Q"}, packages...)
+	cmd := exec.Command("pacman", args...)
+	cmd.Env = append(os.Environ(), "LANG=C", "LC_ALL=C")
+	// Ignore the exit status: partial output still identifies the installed subset
+	output, _ := cmd.Output()
+	return strings.TrimSpace(string(output))
+}
+
 // GetIconFromPackage finds the largest icon file (png or svg) installed by a package
 // This is a Go implementation of the original bash get_icon_from_package function
 func GetIconFromPackage(packages ...string) (string, error) {
@@ -1081,6 +1088,17 @@ func GetIconFromPackage(packages ...string) (string, error) {
 		return "", fmt.Errorf("get_icon_from_package requires at least one pacman package name")
 	}
 
+	// Short-circuit to the cached icon when one was already extracted for
+	// these packages at their currently installed versions
+	directory := GetPiAppsDir()
+	cacheKey := strings.Join(packages, " ")
+	versions := installedPackageVersions(packages)
+	if directory != "" && versions != "" {
+		if icon, ok := lookupPackageIcon(directory, cacheKey, versions); ok {
+			return icon, nil
+		}
+	}
+
 	// Find dependencies that start with the same name as the original packages
 	var extraPackages []string
 	for _, pkg := range packages {
@@ -1199,8 +1217,14 @@ func GetIconFromPackage(packages ...string) (string, error) {
 		return fileSizes[i].Size > fileSizes[j].Size
 	})
 
-	// Return the path of the largest file
+	// Return the path of the largest file, keeping a versioned copy so the
+	// next lookup for these packages skips the hunt entirely
 	if len(fileSizes) > 0 {
+		if directory != "" && versions != "" {
+			if cached, err := storePackageIcon(directory, cacheKey, versions, fileSizes[0].Path); err == nil {
+				return cached, nil
+			}
+		}
 		return fileSizes[0].Path, nil
 	}
 
@@ -619,6 +619,22 @@ func installPackageAppDependencies(dependencies ...string) error {
 	return nil
 }
 
+// prefetchPackageAppDependencies downloads the dependencies for a
+// package-based app into the pacman package cache without installing them
+func prefetchPackageAppDependencies(dependencies ...string) error {
+	// Download packages with sudo; the later install reuses the cache
+	cmd := exec.Command("sudo", append([]string{"pacman", "-Sw", "--noconfirm", "--needed"}, dependencies...)...)
+	cmd.Stdout = os.Stdout
+	cmd.Stderr = os.Stderr
+
+	err := cmd.Run()
+	if err != nil {
+		return fmt.Errorf("failed to download dependencies: %v", err)
+	}
+
+	return nil
+}
+
 // uninstallPackageAppDependencies uninstalls the dependencies for a package-based app
 func uninstallPackageAppDependencies(dependencies ...string) error {
 	// Uninstall packages with sudo
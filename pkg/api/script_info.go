@@ -21,14 +21,9 @@
 package api
 
 import (
-	"bufio"
 	"fmt"
-	"io"
-	"net/http"
 	"os"
 	"path/filepath"
-	"strings"
-	"time"
 )
 
 // UserCount returns number of users for specified app
@@ -39,87 +34,28 @@ func UserCount(app string) (string, error) {
 		return "", fmt.Errorf("PI_APPS_DIR environment variable not set")
 	}
 
-	clicklistPath := filepath.Join(directory, "data", "clicklist")
-
-	// Check if clicklist file is missing or older than a day
-	needsUpdate := false
-	fileInfo, err := os.Stat(clicklistPath)
-	if err != nil {
-		if os.IsNotExist(err) {
-			// File doesn't exist, so we need to download it
-			needsUpdate = true
-		} else {
-			return "", fmt.Errorf("error checking clicklist file: %w", err)
-		}
-	} else {
-		// File exists, check if it's older than a day
-		if time.Since(fileInfo.ModTime()).Hours() > 24 {
-			needsUpdate = true
-		}
-	}
-
-	// Download fresh clicklist if needed
-	if needsUpdate {
-		StatusT("Downloading latest clicklist data...")
-
-		// Ensure the data directory exists
-		dataDir := filepath.Join(directory, "data")
-		if err := os.MkdirAll(dataDir, 0755); err != nil {
-			return "", fmt.Errorf("failed to create data directory: %w", err)
-		}
-
-		// Download the clicklist file
-		resp, err := http.Get("https://raw.githubusercontent.com/Botspot/pi-apps-analytics/main/clicklist")
-		if err != nil {
-			return "", fmt.Errorf("failed to download clicklist: %w", err)
-		}
-		defer resp.Body.Close()
-
-		// Create the clicklist file
-		out, err := os.Create(clicklistPath)
-		if err != nil {
-			return "", fmt.Errorf("failed to create clicklist file: %w", err)
-		}
-		defer out.Close()
-
-		// Write the response to the file
-		_, err = io.Copy(out, resp.Body)
-		if err != nil {
-			return "", fmt.Errorf("failed to write clicklist file: %w", err)
-		}
-	}
-
-	// Read the clicklist file
-	clicklistData, err := os.ReadFile(clicklistPath)
+	// The clicklist cache keeps an in-memory app -> count index and
+	// refreshes stale data in the background, so this never blocks on the
+	// network once any cache exists (see clicklist.go)
+	index, err := getClicklistIndex(directory)
 	if err != nil {
-		return "", fmt.Errorf("failed to read clicklist file: %w", err)
-	}
-
-	clicklist := string(clicklistData)
-	if clicklist == "" {
-		return "", fmt.Errorf("usercount(): clicklist empty. Likely no internet connection")
+		return "", err
 	}
 
 	// If no app specified, return the entire clicklist
 	if app == "" {
-		return clicklist, nil
-	}
-
-	// Parse the clicklist to find the user count for the specified app
-	scanner := bufio.NewScanner(strings.NewReader(clicklist))
-	for scanner.Scan() {
-		line := scanner.Text()
-		if strings.HasSuffix(line, " "+app) {
-			// Extract the count from the beginning of the line
-			fields := strings.Fields(line)
-			if len(fields) > 0 {
-				return fields[0], nil // Return the count
-			}
+		clicklistData, err := os.ReadFile(filepath.Join(directory, "data", "clicklist"))
+		if err != nil {
+			return "", fmt.Errorf("failed to read clicklist file: %w", err)
+		}
+		if len(clicklistData) == 0 {
+			return "", fmt.Errorf("usercount(): clicklist empty. Likely no internet connection")
 		}
+		return string(clicklistData), nil
 	}
 
-	// No match found, return empty string
-	return "", nil
+	// No match found returns an empty string, as before
+	return index.counts[app], nil
 }
 
 // ScriptName returns name of install script(s) for the specified app
@@ -0,0 +1,347 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: search_index.go
+// Description: Provides a persistent inverted index (token -> app postings)
+// over app metadata so AppSearch answers interactive queries from memory
+// instead of re-reading every description/credits/website file per keystroke.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"encoding/gob"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+	"unicode"
+)
+
+// defaultSearchFiles are the per-app metadata files covered by the index,
+// matching the defaults of AppSearch
+var defaultSearchFiles = []string{"description", "website", "credits"}
+
+// searchIndex is an inverted index over app metadata. Tokens is kept sorted
+// so prefix queries can binary-search instead of scanning the whole
+// vocabulary.
+type searchIndex struct {
+	Apps     []string           // all indexed app names
+	Tokens   []string           // sorted vocabulary
+	Postings map[string][]int32 // token -> sorted indices into Apps
+}
+
+// In-process cache, revalidated against the apps directory fingerprint so
+// the index refreshes as soon as the updater touches apps/
+var (
+	searchIndexMu     sync.Mutex
+	searchIndexCache  = make(map[string]*searchIndex)
+	searchIndexFprint = make(map[string]int64)
+)
+
+// searchIndexPath returns the location of the persistent inverted index
+func searchIndexPath(directory string) string {
+	return filepath.Join(directory, "data", "index", "search.bin")
+}
+
+// searchIndexFingerprint fingerprints the sources of the search index
+func searchIndexFingerprint(directory string) int64 {
+	return dirFingerprint(filepath.Join(directory, "apps"))
+}
+
+// tokenizeForSearch splits text into lowercase alphanumeric tokens
+func tokenizeForSearch(text string) []string {
+	return strings.FieldsFunc(strings.ToLower(text), func(r rune) bool {
+		return !unicode.IsLetter(r) && !unicode.IsDigit(r)
+	})
+}
+
+// isDefaultSearchFiles reports whether the requested search files are covered
+// by the persistent index
+func isDefaultSearchFiles(searchFiles []string) bool {
+	if len(searchFiles) != len(defaultSearchFiles) {
+		return false
+	}
+	for _, file := range searchFiles {
+		found := false
+		for _, covered := range defaultSearchFiles {
+			if file == covered {
+				found = true
+				break
+			}
+		}
+		if !found {
+			return false
+		}
+	}
+	return true
+}
+
+// loadSearchIndex returns an up-to-date inverted index for the given Pi-Apps
+// directory, serving from memory when possible, then from the on-disk index,
+// and rebuilding it when the apps tree has changed.
+func loadSearchIndex(directory string) (*searchIndex, error) {
+	searchIndexMu.Lock()
+	defer searchIndexMu.Unlock()
+
+	current := searchIndexFingerprint(directory)
+
+	if cached, ok := searchIndexCache[directory]; ok && searchIndexFprint[directory] == current {
+		return cached, nil
+	}
+
+	// Try the on-disk index
+	if index, fprint, err := readSearchIndexFile(searchIndexPath(directory)); err == nil && fprint == current {
+		searchIndexCache[directory] = index
+		searchIndexFprint[directory] = current
+		return index, nil
+	}
+
+	// Rebuild from the app metadata
+	index, err := buildSearchIndex(directory)
+	if err != nil {
+		return nil, err
+	}
+
+	if err := writeSearchIndexFile(searchIndexPath(directory), index, current); err == nil {
+		searchIndexCache[directory] = index
+		searchIndexFprint[directory] = current
+	}
+
+	return index, nil
+}
+
+// buildSearchIndex reads every app's metadata files once (concurrently, via
+// the shared scanner) and builds the inverted index
+func buildSearchIndex(directory string) (*searchIndex, error) {
+	appsDir := filepath.Join(directory, "apps")
+
+	type appTokens struct {
+		name   string
+		tokens map[string]bool
+	}
+
+	var mu sync.Mutex
+	var scanned []appTokens
+
+	err := scanAppDirs(appsDir, func(appName, appDir string, files []os.DirEntry) {
+		// Only index real apps, matching listLocalApps
+		if !dirEntriesContain(files, "install") &&
+			!dirEntriesContain(files, "install-32") &&
+			!dirEntriesContain(files, "install-64") &&
+			!dirEntriesContain(files, "packages") &&
+			!dirEntriesContain(files, "flatpak_packages") {
+			return
+		}
+
+		tokens := make(map[string]bool)
+		for _, token := range tokenizeForSearch(appName) {
+			tokens[token] = true
+		}
+		for _, fileName := range defaultSearchFiles {
+			if !dirEntriesContain(files, fileName) {
+				continue
+			}
+			content, err := os.ReadFile(filepath.Join(appDir, fileName))
+			if err != nil {
+				continue
+			}
+			for _, token := range tokenizeForSearch(string(content)) {
+				tokens[token] = true
+			}
+		}
+
+		mu.Lock()
+		scanned = append(scanned, appTokens{name: appName, tokens: tokens})
+		mu.Unlock()
+	})
+	if err != nil {
+		return nil, fmt.Errorf("failed to scan apps for search index: %w", err)
+	}
+
+	sort.Slice(scanned, func(i, j int) bool { return scanned[i].name < scanned[j].name })
+
+	index := &searchIndex{Postings: make(map[string][]int32)}
+	for i, app := range scanned {
+		index.Apps = append(index.Apps, app.name)
+		for token := range app.tokens {
+			index.Postings[token] = append(index.Postings[token], int32(i))
+		}
+	}
+
+	index.Tokens = make([]string, 0, len(index.Postings))
+	for token := range index.Postings {
+		index.Tokens = append(index.Tokens, token)
+	}
+	sort.Strings(index.Tokens)
+
+	return index, nil
+}
+
+// searchIndexFile is the on-disk form of the index plus its fingerprint
+type searchIndexFile struct {
+	Fingerprint int64
+	Index       searchIndex
+}
+
+// writeSearchIndexFile atomically replaces the persistent index file
+func writeSearchIndexFile(path string, index *searchIndex, fingerprint int64) error {
+	if err := os.MkdirAll(filepath.Dir(path), 0755); err != nil {
+		return fmt.Errorf("failed to create index directory: %w", err)
+	}
+
+	tmpFile := path + "-tmp"
+	file, err := os.Create(tmpFile)
+	if err != nil {
+		return fmt.Errorf("failed to create search index file: %w", err)
+	}
+
+	encoder := gob.NewEncoder(file)
+	if err := encoder.Encode(searchIndexFile{Fingerprint: fingerprint, Index: *index}); err != nil {
+		file.Close()
+		os.Remove(tmpFile)
+		return fmt.Errorf("failed to encode search index: %w", err)
+	}
+
+	if err := file.Close(); err != nil {
+		return err
+	}
+	return os.Rename(tmpFile, path)
+}
+
+// readSearchIndexFile loads the persistent index file
+func readSearchIndexFile(path string) (*searchIndex, int64, error) {
+	file, err := os.Open(path)
+	if err != nil {
+		return nil, 0, err
+	}
+	defer file.Close()
+
+	var stored searchIndexFile
+	if err := gob.NewDecoder(file).Decode(&stored); err != nil {
+		return nil, 0, fmt.Errorf("failed to decode search index: %w", err)
+	}
+
+	return &stored.Index, stored.Fingerprint, nil
+}
+
+// lookup returns the apps matching the query, ranked. Each query token must
+// match some indexed token (exact, prefix, or substring, in decreasing rank),
+// and app-name matches always rank above metadata-only matches so the result
+// order is stable for interactive search.
+func (idx *searchIndex) lookup(query string) []string {
+	queryTokens := tokenizeForSearch(query)
+	if len(queryTokens) == 0 {
+		return nil
+	}
+
+	// score per app index; 0 means not a candidate
+	scores := make(map[int32]int)
+
+	for i, queryToken := range queryTokens {
+		matched := make(map[int32]int)
+
+		// Prefix matches (including exact) via binary search over the sorted
+		// vocabulary
+		start := sort.SearchStrings(idx.Tokens, queryToken)
+		for j := start; j < len(idx.Tokens) && strings.HasPrefix(idx.Tokens[j], queryToken); j++ {
+			weight := 2
+			if idx.Tokens[j] == queryToken {
+				weight = 3
+			}
+			for _, app := range idx.Postings[idx.Tokens[j]] {
+				if weight > matched[app] {
+					matched[app] = weight
+				}
+			}
+		}
+
+		// Substring matches over the rest of the vocabulary
+		for _, token := range idx.Tokens {
+			if strings.HasPrefix(token, queryToken) {
+				continue // already covered by the prefix pass
+			}
+			if strings.Contains(token, queryToken) {
+				for _, app := range idx.Postings[token] {
+					if matched[app] == 0 {
+						matched[app] = 1
+					}
+				}
+			}
+		}
+
+		// AND across query tokens: keep only apps that matched every token
+		if i == 0 {
+			for app, weight := range matched {
+				scores[app] = weight
+			}
+		} else {
+			for app := range scores {
+				if weight, ok := matched[app]; ok {
+					scores[app] += weight
+				} else {
+					delete(scores, app)
+				}
+			}
+		}
+	}
+
+	// Boost apps whose name contains the raw query so they rank first
+	queryLower := strings.ToLower(strings.TrimSpace(query))
+	type rankedApp struct {
+		name  string
+		score int
+	}
+	var ranked []rankedApp
+	for app, score := range scores {
+		name := idx.Apps[app]
+		nameLower := strings.ToLower(name)
+		if strings.HasPrefix(nameLower, queryLower) {
+			score += 100
+		} else if strings.Contains(nameLower, queryLower) {
+			score += 50
+		}
+		ranked = append(ranked, rankedApp{name: name, score: score})
+	}
+
+	// Also include pure name substring matches that had no token match
+	// (e.g. queries spanning token boundaries like "pi-apps")
+	if queryLower != "" {
+		for i, name := range idx.Apps {
+			if _, already := scores[int32(i)]; already {
+				continue
+			}
+			if strings.Contains(strings.ToLower(name), queryLower) {
+				ranked = append(ranked, rankedApp{name: name, score: 50})
+			}
+		}
+	}
+
+	sort.Slice(ranked, func(i, j int) bool {
+		if ranked[i].score != ranked[j].score {
+			return ranked[i].score > ranked[j].score
+		}
+		return ranked[i].name < ranked[j].name
+	})
+
+	results := make([]string, 0, len(ranked))
+	for _, app := range ranked {
+		results = append(results, app.name)
+	}
+	return results
+}
@@ -37,6 +37,7 @@ import (
 	"slices"
 	"strconv"
 	"strings"
+	"sync"
 	"syscall"
 	"time"
 
@@ -63,6 +64,96 @@ type SystemOSInfo struct {
 	Architecture string // arm64, armhf, amd64, etc.
 }
 
+// Cached result of the last support evaluation; the checks only re-run when
+// systemSupportFingerprint changes (new boot, OS upgrade, package database
+// change), so repeat calls within a session and across invocations are free
+var (
+	systemSupportMu     sync.Mutex
+	systemSupportCached *SystemSupportStatus
+)
+
+// systemSupportCacheFile is the on-disk cache under the data directory
+const systemSupportCacheFile = "system-support.json"
+
+// systemSupportCacheEntry is the persisted form of a support verdict
+type systemSupportCacheEntry struct {
+	Fingerprint string              `json:"fingerprint"`
+	Status      SystemSupportStatus `json:"status"`
+}
+
+// systemSupportFingerprint identifies the system state the support verdict
+// depends on: a new boot, an OS upgrade, a package database change, a
+// different user or a different build each produce a different value
+func systemSupportFingerprint() string {
+	parts := []string{
+		strconv.Itoa(os.Geteuid()),
+		PackageManager,
+		runtime.GOARCH,
+	}
+	if data, err := os.ReadFile("/proc/sys/kernel/random/boot_id"); err == nil {
+		parts = append(parts, strings.TrimSpace(string(data)))
+	}
+	for _, path := range []string{"/etc/os-release", packageStatusFile()} {
+		if info, err := os.Stat(path); err == nil {
+			parts = append(parts, fmt.Sprintf("%s:%d:%d", path, info.ModTime().UnixNano(), info.Size()))
+		} else {
+			parts = append(parts, path+":absent")
+		}
+	}
+	return strings.Join(parts, "|")
+}
+
+// packageStatusFile returns the file whose modification time tracks changes
+// to the installed-package database for the compiled package manager
+func packageStatusFile() string {
+	switch PackageManager {
+	case "pacman":
+		return "/var/lib/pacman/local"
+	case "apk":
+		return "/lib/apk/db/installed"
+	default:
+		return "/var/lib/dpkg/status"
+	}
+}
+
+// loadSystemSupportCache returns the persisted verdict if it matches the
+// current fingerprint. Missing or corrupt caches just mean a re-evaluation.
+func loadSystemSupportCache(fingerprint string) (*SystemSupportStatus, bool) {
+	directory := GetPiAppsDir()
+	if directory == "" {
+		return nil, false
+	}
+	data, err := os.ReadFile(filepath.Join(directory, "data", systemSupportCacheFile))
+	if err != nil {
+		return nil, false
+	}
+	var entry systemSupportCacheEntry
+	if err := json.Unmarshal(data, &entry); err != nil || entry.Fingerprint != fingerprint {
+		return nil, false
+	}
+	status := entry.Status
+	return &status, true
+}
+
+// saveSystemSupportCache persists the verdict; failures are not worth
+// surfacing since the cache only saves time
+func saveSystemSupportCache(fingerprint string, status *SystemSupportStatus) {
+	directory := GetPiAppsDir()
+	if directory == "" {
+		return
+	}
+	entry := systemSupportCacheEntry{Fingerprint: fingerprint, Status: *status}
+	data, err := json.MarshalIndent(entry, "", "\t")
+	if err != nil {
+		return
+	}
+	dataDir := filepath.Join(directory, "data")
+	if err := os.MkdirAll(dataDir, 0755); err != nil {
+		return
+	}
+	os.WriteFile(filepath.Join(dataDir, systemSupportCacheFile), data, 0644)
+}
+
 // IsSystemSupported checks if the current system is supported by Pi-Apps
 //
 // # It returns a status object containing information about support status
@@ -71,7 +162,38 @@ type SystemOSInfo struct {
 //
 //	IsSupported - is the current system supported or not (true - supported, otherwaise false)
 //	Message - A message explaining in the current state if the system is supported or not
+//
+// The verdict is cached, in memory and under data/system-support.json, and
+// only re-evaluated when the boot id, /etc/os-release or the package
+// database change — install flows re-checking support cost nothing.
 func IsSystemSupported() (*SystemSupportStatus, error) {
+	systemSupportMu.Lock()
+	defer systemSupportMu.Unlock()
+
+	if systemSupportCached != nil {
+		return systemSupportCached, nil
+	}
+
+	fingerprint := systemSupportFingerprint()
+	if cached, ok := loadSystemSupportCache(fingerprint); ok {
+		systemSupportCached = cached
+		return cached, nil
+	}
+
+	status, err := evaluateSystemSupport()
+	if err != nil {
+		return nil, err
+	}
+	systemSupportCached = status
+	saveSystemSupportCache(fingerprint, status)
+	return status, nil
+}
+
+// evaluateSystemSupport runs the full battery of support checks. The cheap
+// local checks run inline; the probes that hit the disk, the package manager
+// or the network run concurrently, and their results are then applied in the
+// same priority order the sequential version used.
+func evaluateSystemSupport() (*SystemSupportStatus, error) {
 	status := &SystemSupportStatus{
 		IsSupported: true,
 		Message:     "",
@@ -103,9 +225,47 @@ func IsSystemSupported() (*SystemSupportStatus, error) {
 		Warning("You are running on riscv64 architecture. Pi-Apps Go is not yet to be confirmed to be supported on this architecture due to lack of hardware to test on.\nTo help us test, please report any issues you encounter while running Pi-Apps Go on this architecture by reporting an issue on the Pi-Apps Go GitHub repository/Discord server or consider donating to the project to fund RISC-V hardware.")
 	}
 
+	// Run the independent probes concurrently; the slow ones (EOL lookup,
+	// package manager queries) dominate, so this takes as long as the
+	// slowest probe rather than the sum of all of them
+	var (
+		musl, android, wsl             bool
+		versionMsg, frankenMsg         string
+		repoMsg, brokenMsg             string
+		frankenErr, repoErr, brokenErr error
+		initAvailable                  bool
+		freeSpace                      uint64
+		spaceErr                       error
+	)
+	isDebian := osInfo.ID == "Debian" || osInfo.ID == "Raspbian"
+
+	var wg sync.WaitGroup
+	probe := func(f func()) {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			f()
+		}()
+	}
+	probe(func() { musl = isMuslSystem() })
+	probe(func() { android = isAndroidSystem() })
+	probe(func() { wsl = isWSLSystem() })
+	// Pi-Apps Go does not use any shell commands because this is a rewrite, so checking for BusyBox commands is not needed.
+	// TODO: Remove the check for BusyBox commands once Pi-Apps Go ditches the use of shell specific commands.
+	probe(func() { checkBusyBoxIssue() })
+	probe(func() { versionMsg = checkOSVersion(osInfo) })
+	if isDebian {
+		probe(func() { frankenMsg, frankenErr = checkFrankenDebian(osInfo) })
+	}
+	probe(func() { initAvailable = PackageAvailable("init", "") })
+	probe(func() { repoMsg, repoErr = checkMissingRepositories(osInfo) })
+	probe(func() { brokenMsg, brokenErr = checkBrokenPackages() })
+	probe(func() { freeSpace, spaceErr = getFreeSpace("/") })
+	wg.Wait()
+
 	// Check for non-glibc C library (like musl)
 	// Note: This check is currently being marked as supported as there are plans for Alpine Linux to be supported in Pi-Apps Go.
-	if isMuslSystem() {
+	if musl {
 		//status.IsSupported = false
 		Warning("While Pi-Apps Go (and the Go ecosystem in general) is meant to be portable, you are running a system with non-glibc C library (like musl). Many apps, especially Electron-based ones, will fail to run properly without a glibc-based compatibility layer or a custom build of Electron with musl libc support (like the ones provided by upstream Alpine repositories). Pi-Apps will automatically hide apps that don't have musl builds or don't work with a glibc compatibility layer.")
 		status.Message = "Running a non-glibc C library, will hide apps that don't support musl."
@@ -114,51 +274,40 @@ func IsSystemSupported() (*SystemSupportStatus, error) {
 
 	// Check for Android environment
 	// Note: This check will disappear once Pi-Apps Go will be proven portable and tested on Android.
-	if isAndroidSystem() {
+	if android {
 		status.IsSupported = false
 		status.Message = "Pi-Apps is not supported on Android. Some apps will work, but others won't."
 		return status, nil
 	}
 
 	// Check for Windows Subsystem for Linux (WSL)
-	if isWSLSystem() {
+	if wsl {
 		status.IsSupported = false
 		status.Message = "Pi-Apps is not supported on WSL."
 		return status, nil
 	}
 
-	// Check for BusyBox commands
-	// Pi-Apps Go does not use any shell commands because this is a rewrite, so checking for BusyBox commands is not needed.
-	// TODO: Remove the check for BusyBox commands once Pi-Apps Go ditches the use of shell specific commands.
-	if busyboxIssue := checkBusyBoxIssue(); busyboxIssue != "" {
-		// We are not using shell commands that are affected by BusyBox issues.
-		//status.Message = busyboxIssue
-		//return status, nil
-	}
-
 	// Check OS version
-	if versionMessage := checkOSVersion(osInfo); versionMessage != "" {
+	if versionMsg != "" {
 		status.IsSupported = false
-		status.Message = versionMessage
+		status.Message = versionMsg
 		return status, nil
 	}
 
 	// Check for FrankenDebian
-	if isDebian := osInfo.ID == "Debian" || osInfo.ID == "Raspbian"; isDebian {
-		frankenDebianMsg, err := checkFrankenDebian(osInfo)
-		if err != nil {
-			return nil, fmt.Errorf("failed to check for FrankenDebian: %w", err)
+	if isDebian {
+		if frankenErr != nil {
+			return nil, fmt.Errorf("failed to check for FrankenDebian: %w", frankenErr)
 		}
-		if frankenDebianMsg != "" {
+		if frankenMsg != "" {
 			status.IsSupported = false
-			status.Message = frankenDebianMsg
+			status.Message = frankenMsg
 			return status, nil
 		}
 	}
 
 	// Check for missing init package
 	// TODO: Change this message depending on the package manager being used.
-	initAvailable := PackageAvailable("init", "")
 	if !initAvailable {
 		status.IsSupported = false
 		status.Message = MissingInitMessage
@@ -166,9 +315,8 @@ func IsSystemSupported() (*SystemSupportStatus, error) {
 	}
 
 	// Check for missing repositories
-	repoMsg, err := checkMissingRepositories(osInfo)
-	if err != nil {
-		return nil, fmt.Errorf("failed to check for missing repositories: %w", err)
+	if repoErr != nil {
+		return nil, fmt.Errorf("failed to check for missing repositories: %w", repoErr)
 	}
 	if repoMsg != "" {
 		status.IsSupported = false
@@ -177,21 +325,19 @@ func IsSystemSupported() (*SystemSupportStatus, error) {
 	}
 
 	// Check for broken packages
-	broken, err := checkBrokenPackages()
-	if err != nil {
-		return nil, fmt.Errorf("failed to check for broken packages: %w", err)
+	if brokenErr != nil {
+		return nil, fmt.Errorf("failed to check for broken packages: %w", brokenErr)
 	}
-	if broken != "" {
+	if brokenMsg != "" {
 		status.IsSupported = false
-		status.Message = broken
+		status.Message = brokenMsg
 		return status, nil
 	}
 
 	// Check disk space
 	const minDiskSpace = 500 * 1024 * 1024 // 500 MB
-	freeSpace, err := getFreeSpace("/")
-	if err != nil {
-		return nil, fmt.Errorf("failed to check free disk space: %w", err)
+	if spaceErr != nil {
+		return nil, fmt.Errorf("failed to check free disk space: %w", spaceErr)
 	}
 	if freeSpace < minDiskSpace {
 		status.Message = "Your system drive has less than 500MB of free space. Watch out for \"disk full\" errors."
@@ -0,0 +1,119 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: trace.go
+// Description: Opt-in hot-path tracing. Setting PI_APPS_TRACE=1 makes the
+// instrumented phases of GUI startup, app management and the updater emit
+// Chrome trace-event JSON (open it at chrome://tracing or ui.perfetto.dev)
+// to PI_APPS_TRACE_FILE, or a pi-apps-trace-<pid>.json file in the
+// temporary directory by default. When the variable is unset every
+// instrumentation point is a single boolean check.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package api
+
+import (
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sync"
+	"time"
+)
+
+var (
+	// traceEnabled is fixed at startup so the disabled path stays one
+	// branch with no locking
+	traceEnabled = os.Getenv("PI_APPS_TRACE") != "" && os.Getenv("PI_APPS_TRACE") != "0"
+
+	traceMu      sync.Mutex
+	traceFile    *os.File
+	traceStarted = time.Now() // span timestamps are relative to process start
+
+	// traceNoop is handed out when tracing is off, so TraceSpan does not
+	// allocate a closure per call
+	traceNoop = func() {}
+)
+
+// traceEvent is one complete-span record in the Chrome trace-event format
+type traceEvent struct {
+	Name     string `json:"name"`
+	Phase    string `json:"ph"`
+	Start    int64  `json:"ts"`  // microseconds since trace start
+	Duration int64  `json:"dur"` // microseconds
+	PID      int    `json:"pid"`
+	TID      int    `json:"tid"`
+}
+
+// TraceEnabled reports whether PI_APPS_TRACE tracing is active
+func TraceEnabled() bool {
+	return traceEnabled
+}
+
+// TraceSpan starts a named span and returns the function that ends it:
+//
+//	defer TraceSpan("manage.run-script")()
+//
+// With tracing disabled this is a boolean check returning a shared no-op.
+func TraceSpan(name string) func() {
+	if !traceEnabled {
+		return traceNoop
+	}
+	start := time.Now()
+	return func() {
+		writeTraceEvent(name, start, time.Since(start))
+	}
+}
+
+// writeTraceEvent appends one span to the trace file, opening it on first use
+func writeTraceEvent(name string, start time.Time, duration time.Duration) {
+	traceMu.Lock()
+	defer traceMu.Unlock()
+
+	if traceFile == nil {
+		path := os.Getenv("PI_APPS_TRACE_FILE")
+		if path == "" {
+			path = filepath.Join(os.TempDir(), fmt.Sprintf("pi-apps-trace-%d.json", os.Getpid()))
+		}
+		file, err := os.Create(path)
+		if err != nil {
+			traceEnabled = false
+			return
+		}
+		// The trace viewers accept an unterminated JSON array, so the
+		// file is valid even if the process exits without a clean close
+		if _, err := file.WriteString("[\n"); err != nil {
+			file.Close()
+			traceEnabled = false
+			return
+		}
+		traceFile = file
+		fmt.Fprintf(os.Stderr, "Tracing to %s\n", path)
+	}
+
+	data, err := json.Marshal(traceEvent{
+		Name:     name,
+		Phase:    "X",
+		Start:    start.Sub(traceStarted).Microseconds(),
+		Duration: duration.Microseconds(),
+		PID:      os.Getpid(),
+		TID:      1,
+	})
+	if err != nil {
+		return
+	}
+	traceFile.Write(append(data, ',', '\n'))
+}
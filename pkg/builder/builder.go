@@ -22,12 +22,18 @@
 package builder
 
 import (
+	"bytes"
 	"context"
+	"crypto/sha256"
+	"encoding/hex"
 	"fmt"
 	"os"
 	"os/exec"
 	"path/filepath"
+	"runtime"
+	"sort"
 	"strings"
+	"sync"
 	"time"
 )
 
@@ -54,7 +60,8 @@ type Builder struct {
 	// Debug enables debug symbols
 	Debug bool `json:"debug,omitempty"`
 
-	// SkipCleanup prevents cleanup of build artifacts
+	// SkipCleanup prevents cleanup of build artifacts. The plugin
+	// workspace itself is always kept so later builds can reuse it.
 	SkipCleanup bool `json:"skip_cleanup,omitempty"`
 
 	// TimeoutBuild is the timeout for build operations
@@ -102,46 +109,108 @@ func DefaultBuilder() *Builder {
 	}
 }
 
-// Build builds pi-apps with the configured plugins
+// workspaceReadyMarker records that a workspace finished initializing; a
+// directory without it is treated as half-built and recreated from scratch
+const workspaceReadyMarker = ".workspace-ready"
+
+// Build builds pi-apps with the configured plugins. The generated module
+// lives in a workspace keyed by the plugin set, so rebuilding with the same
+// plugins reuses the existing go.mod and compile cache instead of
+// re-resolving and recompiling everything from scratch.
 func (b *Builder) Build(ctx context.Context, outputFile string) error {
-	// Create temporary directory for build
-	tmpDir, err := os.MkdirTemp("", "xpi-apps-build-*")
+	buildDir, reused, err := b.prepareWorkspace()
 	if err != nil {
-		return fmt.Errorf("failed to create temp directory: %w", err)
-	}
-
-	if !b.SkipCleanup {
-		defer os.RemoveAll(tmpDir)
+		return fmt.Errorf("failed to prepare build workspace: %w", err)
 	}
 
 	// Create main.go with plugin imports
-	mainFile := filepath.Join(tmpDir, "main.go")
+	mainFile := filepath.Join(buildDir, "main.go")
 	if err := b.createMainFile(mainFile); err != nil {
 		return fmt.Errorf("failed to create main.go: %w", err)
 	}
 
-	// Initialize go module
-	if err := b.initGoModule(ctx, tmpDir); err != nil {
-		return fmt.Errorf("failed to initialize go module: %w", err)
-	}
+	if !reused {
+		// Initialize go module
+		if err := b.initGoModule(ctx, buildDir); err != nil {
+			return fmt.Errorf("failed to initialize go module: %w", err)
+		}
 
-	// Add plugins and replacements
-	if err := b.addPlugins(ctx, tmpDir); err != nil {
-		return fmt.Errorf("failed to add plugins: %w", err)
-	}
+		// Add plugins and replacements
+		if err := b.addPlugins(ctx, buildDir); err != nil {
+			return fmt.Errorf("failed to add plugins: %w", err)
+		}
+
+		if err := b.addReplacements(ctx, buildDir); err != nil {
+			return fmt.Errorf("failed to add replacements: %w", err)
+		}
 
-	if err := b.addReplacements(ctx, tmpDir); err != nil {
-		return fmt.Errorf("failed to add replacements: %w", err)
+		if err := markWorkspaceReady(buildDir); err != nil {
+			return fmt.Errorf("failed to mark workspace ready: %w", err)
+		}
 	}
 
 	// Build the binary
-	if err := b.buildBinary(ctx, tmpDir, outputFile); err != nil {
+	if err := b.buildBinary(ctx, buildDir, outputFile); err != nil {
 		return fmt.Errorf("failed to build binary: %w", err)
 	}
 
 	return nil
 }
 
+// workspaceFingerprint hashes everything that shapes the generated module:
+// the pi-apps version and source path, the plugin set and the replacements.
+// Any change lands in a different workspace; an identical build reuses one.
+func (b *Builder) workspaceFingerprint() string {
+	hash := sha256.New()
+	fmt.Fprintln(hash, b.PiAppsVersion)
+
+	workDir, _ := os.Getwd()
+	fmt.Fprintln(hash, workDir)
+
+	specs := make([]string, 0, len(b.Plugins)+len(b.Replacements))
+	for _, plugin := range b.Plugins {
+		specs = append(specs, plugin.String()+"="+plugin.ReplacementPath)
+	}
+	for _, replacement := range b.Replacements {
+		specs = append(specs, replacement.Old+"="+replacement.New)
+	}
+	sort.Strings(specs)
+	for _, spec := range specs {
+		fmt.Fprintln(hash, spec)
+	}
+
+	return hex.EncodeToString(hash.Sum(nil))[:12]
+}
+
+// prepareWorkspace returns the persistent build directory for the current
+// plugin set, reporting whether an already-initialized one was found
+func (b *Builder) prepareWorkspace() (string, bool, error) {
+	root, err := os.UserCacheDir()
+	if err != nil {
+		root = os.TempDir()
+	}
+	dir := filepath.Join(root, "pi-apps-go", "builder", "ws-"+b.workspaceFingerprint())
+
+	if _, err := os.Stat(filepath.Join(dir, workspaceReadyMarker)); err == nil {
+		return dir, true, nil
+	}
+
+	// No marker means a previous run never finished setting the module up;
+	// start over rather than layering onto a half-built workspace
+	if err := os.RemoveAll(dir); err != nil {
+		return "", false, fmt.Errorf("failed to clear stale workspace: %w", err)
+	}
+	if err := os.MkdirAll(dir, 0755); err != nil {
+		return "", false, fmt.Errorf("failed to create workspace directory: %w", err)
+	}
+	return dir, false, nil
+}
+
+// markWorkspaceReady records that the workspace module is fully set up
+func markWorkspaceReady(buildDir string) error {
+	return os.WriteFile(filepath.Join(buildDir, workspaceReadyMarker), []byte(time.Now().Format(time.RFC3339)+"\n"), 0644)
+}
+
 // createMainFile creates the main.go file with plugin imports
 func (b *Builder) createMainFile(mainFile string) error {
 	var imports []string
@@ -304,14 +373,21 @@ func main() {
 }
 `, strings.Join(imports, "\n"))
 
-	return os.WriteFile(mainFile, []byte(mainContent), 0644)
+	// Leave an identical main.go untouched so the compile cache from the
+	// previous run stays valid
+	data := []byte(mainContent)
+	if existing, err := os.ReadFile(mainFile); err == nil && bytes.Equal(existing, data) {
+		return nil
+	}
+
+	return os.WriteFile(mainFile, data, 0644)
 }
 
 // initGoModule initializes the go module
-func (b *Builder) initGoModule(ctx context.Context, tmpDir string) error {
+func (b *Builder) initGoModule(ctx context.Context, buildDir string) error {
 	// Initialize go module
 	cmd := exec.CommandContext(ctx, "go", "mod", "init", "pi-apps-custom")
-	cmd.Dir = tmpDir
+	cmd.Dir = buildDir
 	if err := cmd.Run(); err != nil {
 		return fmt.Errorf("failed to initialize go module: %w", err)
 	}
@@ -319,7 +395,7 @@ func (b *Builder) initGoModule(ctx context.Context, tmpDir string) error {
 	// Add pi-apps dependency using local replacement
 	// Since we're in development, use the local pi-apps module
 	cmd = exec.CommandContext(ctx, "go", "mod", "edit", "-require", "github.com/pi-apps-go/pi-apps@latest")
-	cmd.Dir = tmpDir
+	cmd.Dir = buildDir
 	if err := cmd.Run(); err != nil {
 		return fmt.Errorf("failed to add pi-apps dependency: %w", err)
 	}
@@ -331,14 +407,14 @@ func (b *Builder) initGoModule(ctx context.Context, tmpDir string) error {
 	}
 
 	cmd = exec.CommandContext(ctx, "go", "mod", "edit", "-replace", fmt.Sprintf("github.com/pi-apps-go/pi-apps=%s", workDir))
-	cmd.Dir = tmpDir
+	cmd.Dir = buildDir
 	if err := cmd.Run(); err != nil {
 		return fmt.Errorf("failed to add pi-apps replacement: %w", err)
 	}
 
 	// Run go mod tidy to resolve dependencies
 	cmd = exec.CommandContext(ctx, "go", "mod", "tidy")
-	cmd.Dir = tmpDir
+	cmd.Dir = buildDir
 	if err := cmd.Run(); err != nil {
 		return fmt.Errorf("failed to tidy dependencies: %w", err)
 	}
@@ -346,8 +422,10 @@ func (b *Builder) initGoModule(ctx context.Context, tmpDir string) error {
 	return nil
 }
 
-// addPlugins adds plugins to the module
-func (b *Builder) addPlugins(ctx context.Context, tmpDir string) error {
+// addPlugins adds plugins to the module. It only runs when a workspace is
+// first created — an unchanged plugin set reuses its workspace without
+// touching go.mod at all — so every entry here is new.
+func (b *Builder) addPlugins(ctx context.Context, buildDir string) error {
 	for _, plugin := range b.Plugins {
 		var args []string
 
@@ -364,20 +442,71 @@ func (b *Builder) addPlugins(ctx context.Context, tmpDir string) error {
 		}
 
 		cmd := exec.CommandContext(ctx, "go", args...)
-		cmd.Dir = tmpDir
+		cmd.Dir = buildDir
 		if err := cmd.Run(); err != nil {
 			return fmt.Errorf("failed to add plugin %s: %w", plugin.ModulePath, err)
 		}
 	}
 
+	return b.fetchPlugins(ctx, buildDir)
+}
+
+// fetchPlugins downloads the newly required plugin modules in parallel so a
+// cold workspace does not pull them one at a time. The go command locks its
+// go.mod, go.sum and module cache writes, so concurrent downloads are safe.
+func (b *Builder) fetchPlugins(ctx context.Context, buildDir string) error {
+	var specs []string
+	for _, plugin := range b.Plugins {
+		if plugin.ReplacementPath == "" {
+			specs = append(specs, plugin.String())
+		}
+	}
+	if len(specs) == 0 {
+		return nil
+	}
+
+	workers := runtime.GOMAXPROCS(0)
+	if workers > len(specs) {
+		workers = len(specs)
+	}
+
+	jobs := make(chan int)
+	errs := make([]error, len(specs))
+
+	var wg sync.WaitGroup
+	for i := 0; i < workers; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for idx := range jobs {
+				cmd := exec.CommandContext(ctx, "go", "mod", "download", specs[idx])
+				cmd.Dir = buildDir
+				if err := cmd.Run(); err != nil {
+					errs[idx] = fmt.Errorf("failed to download plugin %s: %w", specs[idx], err)
+				}
+			}
+		}()
+	}
+
+	for idx := range specs {
+		jobs <- idx
+	}
+	close(jobs)
+	wg.Wait()
+
+	for _, err := range errs {
+		if err != nil {
+			return err
+		}
+	}
 	return nil
 }
 
 // addReplacements adds module replacements
-func (b *Builder) addReplacements(ctx context.Context, tmpDir string) error {
+func (b *Builder) addReplacements(ctx context.Context, buildDir string) error {
 	for _, replacement := range b.Replacements {
 		cmd := exec.CommandContext(ctx, "go", "mod", "edit", "-replace", fmt.Sprintf("%s=%s", replacement.Old, replacement.New))
-		cmd.Dir = tmpDir
+		cmd.Dir = buildDir
 		if err := cmd.Run(); err != nil {
 			return fmt.Errorf("failed to add replacement %s=%s: %w", replacement.Old, replacement.New, err)
 		}
@@ -387,10 +516,11 @@ func (b *Builder) addReplacements(ctx context.Context, tmpDir string) error {
 }
 
 // buildBinary builds the final binary
-func (b *Builder) buildBinary(ctx context.Context, tmpDir, outputFile string) error {
-	// Download dependencies
+func (b *Builder) buildBinary(ctx context.Context, buildDir, outputFile string) error {
+	// Download any remaining dependencies; with a reused workspace and a
+	// warm module cache this is a no-op
 	cmd := exec.CommandContext(ctx, "go", "mod", "download")
-	cmd.Dir = tmpDir
+	cmd.Dir = buildDir
 	if err := cmd.Run(); err != nil {
 		return fmt.Errorf("failed to download dependencies: %w", err)
 	}
@@ -425,7 +555,7 @@ func (b *Builder) buildBinary(ctx context.Context, tmpDir, outputFile string) er
 	args = append(args, ".")
 
 	cmd = exec.CommandContext(ctx, "go", args...)
-	cmd.Dir = tmpDir
+	cmd.Dir = buildDir
 	cmd.Stdout = os.Stdout
 	cmd.Stderr = os.Stderr
 
@@ -30,6 +30,7 @@ import (
 	"encoding/json"
 	"fmt"
 	"log"
+	"net"
 	"net/http"
 	"os"
 	"sync"
@@ -47,15 +48,28 @@ const (
 	RateLimitRequests = 10
 	// RateLimitPeriod is the time window for rate limiting
 	RateLimitPeriod = 1 * time.Hour
+	// MaxReportSize bounds the memory and upstream transfer per report
+	// (Discord rejects larger uploads anyway)
+	MaxReportSize = 8 << 20
+	// MaxConcurrentPerIP is how many reports one address may have in
+	// flight; a flood from one IP queues behind itself, not behind others
+	MaxConcurrentPerIP = 4
 )
 
 // Server represents the error report server
 type Server struct {
-	router      *mux.Router
-	webhookURL  string
-	tokens      map[string]time.Time
-	tokensMutex sync.RWMutex
-	limiter     *rate.Limiter
+	router     *mux.Router
+	webhookURL string
+	// tokens maps token -> expiry; sync.Map keeps issuing and consuming
+	// lock-free under concurrent reports, and consuming uses
+	// LoadAndDelete so a token cannot be redeemed twice
+	tokens  sync.Map
+	limiter *rate.Limiter
+	client  *http.Client
+
+	// In-flight report count per client address
+	ipActiveMu sync.Mutex
+	ipActive   map[string]int
 }
 
 // TokenResponse represents the response when requesting a token
@@ -74,8 +88,9 @@ func NewServer(webhookURL string) *Server {
 	s := &Server{
 		router:     mux.NewRouter(),
 		webhookURL: os.Getenv("DISCORD_WEBHOOK_URL"),
-		tokens:     make(map[string]time.Time),
 		limiter:    rate.NewLimiter(rate.Every(RateLimitPeriod/RateLimitRequests), RateLimitRequests),
+		client:     &http.Client{Timeout: 60 * time.Second},
+		ipActive:   make(map[string]int),
 	}
 
 	s.setupRoutes()
@@ -110,9 +125,7 @@ func (s *Server) handleTokenRequest(w http.ResponseWriter, r *http.Request) {
 		return
 	}
 
-	s.tokensMutex.Lock()
-	s.tokens[token] = time.Now().Add(TokenExpiration)
-	s.tokensMutex.Unlock()
+	s.tokens.Store(token, time.Now().Add(TokenExpiration))
 
 	response := TokenResponse{Token: token}
 	w.Header().Set("Content-Type", "application/json")
@@ -121,25 +134,29 @@ func (s *Server) handleTokenRequest(w http.ResponseWriter, r *http.Request) {
 
 // handleErrorReport processes an error report submission
 func (s *Server) handleErrorReport(w http.ResponseWriter, r *http.Request) {
+	ip := clientIP(r)
+	if !s.acquireIP(ip) {
+		http.Error(w, "Too many concurrent reports from this address", http.StatusTooManyRequests)
+		return
+	}
+	defer s.releaseIP(ip)
+
 	token := r.Header.Get("X-Error-Report-Token")
 	if token == "" {
 		http.Error(w, "Missing token", http.StatusUnauthorized)
 		return
 	}
 
-	s.tokensMutex.RLock()
-	expiry, valid := s.tokens[token]
-	s.tokensMutex.RUnlock()
-
-	if !valid || time.Now().After(expiry) {
+	// Consume the token atomically; expired entries are removed lazily
+	// right here, whether or not the cleanup loop got to them first
+	expiry, valid := s.tokens.LoadAndDelete(token)
+	if !valid || time.Now().After(expiry.(time.Time)) {
 		http.Error(w, "Invalid or expired token", http.StatusUnauthorized)
 		return
 	}
 
-	// Remove the used token
-	s.tokensMutex.Lock()
-	delete(s.tokens, token)
-	s.tokensMutex.Unlock()
+	// Bound what one connection may make us hold or forward
+	r.Body = http.MaxBytesReader(w, r.Body, MaxReportSize)
 
 	// Forward the report to Discord webhook
 	if err := s.forwardToDiscord(r); err != nil {
@@ -150,20 +167,56 @@ func (s *Server) handleErrorReport(w http.ResponseWriter, r *http.Request) {
 	w.WriteHeader(http.StatusOK)
 }
 
-// forwardToDiscord forwards the error report to Discord
+// acquireIP reserves one in-flight report slot for the address, refusing
+// when the address already has MaxConcurrentPerIP reports running
+func (s *Server) acquireIP(ip string) bool {
+	s.ipActiveMu.Lock()
+	defer s.ipActiveMu.Unlock()
+	if s.ipActive[ip] >= MaxConcurrentPerIP {
+		return false
+	}
+	s.ipActive[ip]++
+	return true
+}
+
+// releaseIP returns the slot taken by acquireIP
+func (s *Server) releaseIP(ip string) {
+	s.ipActiveMu.Lock()
+	defer s.ipActiveMu.Unlock()
+	if s.ipActive[ip] <= 1 {
+		delete(s.ipActive, ip)
+	} else {
+		s.ipActive[ip]--
+	}
+}
+
+// clientIP returns the remote address without the port
+func clientIP(r *http.Request) string {
+	if host, _, err := net.SplitHostPort(r.RemoteAddr); err == nil {
+		return host
+	}
+	return r.RemoteAddr
+}
+
+// forwardToDiscord streams the error report through to Discord. The client
+// body is handed to the outbound request unread, so a multi-MB log is copied
+// network-to-network in fixed-size chunks and never buffered whole.
 func (s *Server) forwardToDiscord(r *http.Request) error {
 	// Create a new request to forward to Discord
-	req, err := http.NewRequest("POST", s.webhookURL, r.Body)
+	req, err := http.NewRequestWithContext(r.Context(), "POST", s.webhookURL, r.Body)
 	if err != nil {
 		return err
 	}
 
-	// Copy relevant headers
+	// Copy relevant headers; passing the length through lets the upload
+	// go out un-chunked when the client declared it
 	req.Header.Set("Content-Type", r.Header.Get("Content-Type"))
+	if r.ContentLength > 0 && r.ContentLength <= MaxReportSize {
+		req.ContentLength = r.ContentLength
+	}
 
-	// Send the request
-	client := &http.Client{}
-	resp, err := client.Do(req)
+	// Send the request on the shared client so connections are reused
+	resp, err := s.client.Do(req)
 	if err != nil {
 		return err
 	}
@@ -186,13 +239,14 @@ func (s *Server) Start(addr string) error {
 func (s *Server) CleanupExpiredTokens() {
 	ticker := time.NewTicker(1 * time.Hour)
 	for range ticker.C {
-		s.tokensMutex.Lock()
+		// Backstop for tokens that were issued but never redeemed;
+		// redeemed ones are already removed lazily on use
 		now := time.Now()
-		for token, expiry := range s.tokens {
-			if now.After(expiry) {
-				delete(s.tokens, token)
+		s.tokens.Range(func(token, expiry any) bool {
+			if now.After(expiry.(time.Time)) {
+				s.tokens.Delete(token)
 			}
-		}
-		s.tokensMutex.Unlock()
+			return true
+		})
 	}
 }
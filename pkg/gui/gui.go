@@ -59,7 +59,9 @@ type GUI struct {
 	ctx              context.Context
 	cancel           context.CancelFunc
 	currentApps      []AppListItem // Store current apps by index for reliable access
+	listGeneration   uint64        // Bumped when the content view changes, cancels pending lazy row batches
 	widgetCount      int           // Track number of widgets created for memory management
+	iconCache        *IconCache    // Pre-scaled icon cache with async loading
 }
 
 // GUIConfig holds configuration for the GUI
@@ -117,6 +119,8 @@ func NewGUI(config GUIConfig) (*GUI, error) {
 
 // Initialize sets up the GUI environment and dependencies
 func (g *GUI) Initialize() error {
+	defer api.TraceSpan("gui.Initialize")()
+
 	// Check if running as root
 	if os.Getuid() == 0 {
 		return fmt.Errorf("Pi-Apps is not designed to be run as root! Please try again as a regular user")
@@ -132,12 +136,21 @@ func (g *GUI) Initialize() error {
 		glib.SetPrgname("Pi-Apps")
 
 		// Initialize GTK
+		endSpan := api.TraceSpan("gui.gtk-init")
 		gtk.Init(nil)
+		endSpan()
 
 		// Get screen dimensions
+		endSpan = api.TraceSpan("gui.screen-dimensions")
 		if err := g.getScreenDimensions(); err != nil {
 			logger.Error("failed to get screen dimensions: %w", err)
 		}
+		endSpan()
+
+		// Load the pre-scaled icon cache and start its decode workers
+		endSpan = api.TraceSpan("gui.icon-cache-init")
+		g.iconCache = newIconCache(g.directory)
+		endSpan()
 	}
 
 	// Create necessary directories
@@ -149,7 +162,9 @@ func (g *GUI) Initialize() error {
 	go g.startBackgroundTasks()
 
 	// Start preload daemon
+	endSpan := api.TraceSpan("gui.start-preload-daemon")
 	daemon, err := StartPreloadDaemon(g.directory)
+	endSpan()
 	if err != nil {
 		logger.Warn(api.Tf("failed to start preload daemon: %v\n", err))
 	} else {
@@ -366,6 +381,9 @@ func (g *GUI) runPreloadDaemonOnceMode() error {
 func (g *GUI) runNativeMode() error {
 	logger.Debug("runNativeMode: Starting GTK3 interface")
 
+	// Everything from here to the first window show is GUI startup
+	endStartup := api.TraceSpan("gui.run-startup")
+
 	// Create main window
 	window, err := gtk.WindowNew(gtk.WINDOW_TOPLEVEL)
 	if err != nil {
@@ -417,10 +435,12 @@ func (g *GUI) runNativeMode() error {
 	logger.Debug("runNativeMode: Main layout created")
 
 	// Create app info header (like the CloudBuddy/WiFi Hotspot area)
+	endSpan := api.TraceSpan("gui.app-info-header")
 	if err := g.createAppInfoHeader(vbox); err != nil {
 		logger.Fatal(fmt.Errorf("failed to create app info header: %w", err))
 		return fmt.Errorf("failed to create app info header: %w", err)
 	}
+	endSpan()
 	logger.Debug("runNativeMode: App info header created")
 
 	// Create content container for switching between views
@@ -434,10 +454,12 @@ func (g *GUI) runNativeMode() error {
 	logger.Debug("runNativeMode: Content container created")
 
 	// Create initial category list view
+	endSpan = api.TraceSpan("gui.category-list")
 	if err := g.showCategoryListView(); err != nil {
 		logger.Fatal(fmt.Errorf("failed to create category list: %w", err))
 		return fmt.Errorf("failed to create category list: %w", err)
 	}
+	endSpan()
 	logger.Debug("runNativeMode: Category list created")
 
 	// Create bottom buttons
@@ -459,6 +481,7 @@ func (g *GUI) runNativeMode() error {
 	// Show window
 	logger.Debug("runNativeMode: Showing window...")
 	window.ShowAll()
+	endStartup()
 
 	// Start GTK main loop
 	logger.Debug("runNativeMode: Starting GTK main loop")
@@ -669,6 +692,9 @@ func (g *GUI) clearContentContainer() {
 		g.currentApps = []AppListItem{}
 	}
 
+	// Cancel any lazy row batches still queued for the old view
+	g.listGeneration++
+
 	// Process pending GTK events to ensure widgets are fully cleaned up
 	for gtk.EventsPending() {
 		gtk.MainIterationDo(false)
@@ -698,8 +724,16 @@ func (g *GUI) createCategoryRow(name, iconFile, description string) (*gtk.ListBo
 		iconPath = filepath.Join(g.directory, "icons", "categories", "default.png")
 	}
 
-	image, err := gtk.ImageNewFromFile(iconPath)
-	if err == nil {
+	if g.iconCache != nil {
+		// Create the image empty and let the cache apply the pre-scaled
+		// pixbuf (asynchronously on a cache miss) so building the list
+		// never blocks on PNG decode
+		if image, err := gtk.ImageNew(); err == nil {
+			image.SetPixelSize(24)
+			hbox.PackStart(image, false, false, 0)
+			g.iconCache.SetImageAsync(iconPath, 24, image)
+		}
+	} else if image, err := gtk.ImageNewFromFile(iconPath); err == nil {
 		image.SetPixelSize(24)
 		hbox.PackStart(image, false, false, 0)
 	}
@@ -1990,16 +2024,19 @@ func (g *GUI) populateAppsInCategory(listBox *gtk.ListBox, category string) {
 	g.currentApps = apps
 	logger.Debug(fmt.Sprintf("Stored %d apps for category %s\n", len(g.currentApps), category))
 
-	// Add each app as a row
-	for _, app := range apps {
-		row, err := g.createAppRow(app)
+	// Build rows lazily: the first screenful synchronously, the rest in
+	// idle batches, so opening a large category costs the visible rows
+	// rather than one widget per app
+	generation := g.listGeneration
+	api.ListBoxPopulateLazily(listBox, len(apps), func() bool {
+		return g.listGeneration != generation
+	}, func(index int) (*gtk.ListBoxRow, error) {
+		row, err := g.createAppRow(apps[index])
 		if err != nil {
-			logger.Error(fmt.Sprintf("Failed to create row for app %s: %v\n", app.Name, err))
-			continue
+			logger.Error(fmt.Sprintf("Failed to create row for app %s: %v\n", apps[index].Name, err))
 		}
-
-		listBox.Add(row)
-	}
+		return row, err
+	})
 }
 
 // addPlaceholderRow adds a placeholder message row
@@ -2048,8 +2085,15 @@ func (g *GUI) createAppRow(app AppListItem) (*gtk.ListBoxRow, error) {
 		iconPath = filepath.Join(g.directory, "icons", "none-24.png")
 	}
 
-	// Load and scale the app icon
-	if pixbuf, err := gdk.PixbufNewFromFile(iconPath); err == nil {
+	// Load and scale the app icon, via the async icon cache when available
+	// so the row is created without waiting on PNG decode
+	if g.iconCache != nil {
+		if image, err := gtk.ImageNew(); err == nil {
+			image.SetPixelSize(24)
+			hbox.PackStart(image, false, false, 0)
+			g.iconCache.SetImageAsync(iconPath, 24, image)
+		}
+	} else if pixbuf, err := gdk.PixbufNewFromFile(iconPath); err == nil {
 		if scaledPixbuf, err := pixbuf.ScaleSimple(24, 24, gdk.INTERP_BILINEAR); err == nil {
 			if image, err := gtk.ImageNewFromPixbuf(scaledPixbuf); err == nil {
 				hbox.PackStart(image, false, false, 0)
@@ -2693,16 +2737,17 @@ func (g *GUI) populateSearchResults(listBox *gtk.ListBox, results []string) {
 	g.currentApps = searchApps
 	logger.Info(fmt.Sprintf("Stored %d search result apps (hidden apps filtered out)", len(g.currentApps)))
 
-	// Add each app as a row with category information
-	for _, app := range searchApps {
-		row, err := g.createSearchResultRow(app, app.Name, categoryEntries)
+	// Build result rows lazily, same as the category view
+	generation := g.listGeneration
+	api.ListBoxPopulateLazily(listBox, len(searchApps), func() bool {
+		return g.listGeneration != generation
+	}, func(index int) (*gtk.ListBoxRow, error) {
+		row, err := g.createSearchResultRow(searchApps[index], searchApps[index].Name, categoryEntries)
 		if err != nil {
-			logger.Error(fmt.Sprintf("Failed to create row for search result %s: %v", app.Name, err))
-			continue
+			logger.Error(fmt.Sprintf("Failed to create row for search result %s: %v", searchApps[index].Name, err))
 		}
-
-		listBox.Add(row)
-	}
+		return row, err
+	})
 
 	if len(searchApps) == 0 {
 		g.addPlaceholderRow(listBox, "No compatible apps found for your search")
@@ -2738,8 +2783,15 @@ func (g *GUI) createSearchResultRow(app AppListItem, appName string, categoryEnt
 		iconPath = filepath.Join(g.directory, "icons", "none-24.png")
 	}
 
-	// Load and scale the app icon
-	if pixbuf, err := gdk.PixbufNewFromFile(iconPath); err == nil {
+	// Load and scale the app icon, via the async icon cache when available
+	// so the row is created without waiting on PNG decode
+	if g.iconCache != nil {
+		if image, err := gtk.ImageNew(); err == nil {
+			image.SetPixelSize(24)
+			hbox.PackStart(image, false, false, 0)
+			g.iconCache.SetImageAsync(iconPath, 24, image)
+		}
+	} else if pixbuf, err := gdk.PixbufNewFromFile(iconPath); err == nil {
 		if scaledPixbuf, err := pixbuf.ScaleSimple(24, 24, gdk.INTERP_BILINEAR); err == nil {
 			if image, err := gtk.ImageNewFromPixbuf(scaledPixbuf); err == nil {
 				hbox.PackStart(image, false, false, 0)
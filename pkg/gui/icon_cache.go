@@ -0,0 +1,393 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: icon_cache.go
+// Description: On-disk cache of pre-scaled icon pixels for the app list.
+// Rows are created with an empty image and the real pixbuf is applied
+// asynchronously from a decode worker pool, so opening a large category
+// paints immediately instead of blocking on PNG decode+scale per row.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package gui
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"os"
+	"path/filepath"
+	"runtime"
+	"sync"
+	"time"
+
+	"github.com/gotk3/gotk3/gdk"
+	"github.com/gotk3/gotk3/glib"
+	"github.com/gotk3/gotk3/gtk"
+)
+
+// Icon cache file layout (all integers little-endian):
+//
+//	[4]byte  magic "PAIC"
+//	uint16   format version
+//	uint16   reserved
+//	uint32   record count
+//	records:
+//	  int64  source file mtime (unix seconds)
+//	  int64  source file size
+//	  int32  requested icon size
+//	  int32  width, int32 height, int32 rowstride
+//	  uint8  has alpha, [3]byte reserved
+//	  string source path (uint16 length + bytes)
+//	  pixels (uint32 length + raw pixbuf bytes)
+const (
+	iconCacheMagic   = "PAIC"
+	iconCacheVersion = 1
+)
+
+// iconCacheKey identifies one scaled icon
+type iconCacheKey struct {
+	path string
+	size int
+}
+
+// iconCacheEntry holds the pre-scaled pixel data plus the source file
+// identity used for invalidation
+type iconCacheEntry struct {
+	MTime     int64
+	FileSize  int64
+	Width     int
+	Height    int
+	Rowstride int
+	HasAlpha  bool
+	Pixels    []byte
+}
+
+// iconCacheTask is one pending async icon load
+type iconCacheTask struct {
+	path  string
+	size  int
+	image *gtk.Image
+}
+
+// IconCache caches pre-scaled icons, persisting them in a single packed file
+// so subsequent startups decode nothing that hasn't changed
+type IconCache struct {
+	directory string
+
+	mu      sync.Mutex
+	entries map[iconCacheKey]*iconCacheEntry
+	pixbufs map[iconCacheKey]*gdk.Pixbuf
+	dirty   bool
+
+	tasks     chan iconCacheTask
+	saveTimer *time.Timer
+}
+
+// iconCachePath returns the location of the packed icon cache file
+func iconCachePath(directory string) string {
+	return filepath.Join(directory, "data", "index", "icons.bin")
+}
+
+// newIconCache loads the packed cache file (memory-mapped on Linux) and
+// starts the decode worker pool
+func newIconCache(directory string) *IconCache {
+	cache := &IconCache{
+		directory: directory,
+		entries:   make(map[iconCacheKey]*iconCacheEntry),
+		pixbufs:   make(map[iconCacheKey]*gdk.Pixbuf),
+		tasks:     make(chan iconCacheTask, 256),
+	}
+
+	if err := cache.loadFile(); err != nil {
+		logger.Debug(fmt.Sprintf("icon cache not loaded (will rebuild): %v\n", err))
+	}
+
+	workers := runtime.GOMAXPROCS(0)
+	if workers > 4 {
+		workers = 4 // Decoding is cheap; don't starve the GTK main loop
+	}
+	for i := 0; i < workers; i++ {
+		go cache.decodeWorker()
+	}
+
+	return cache
+}
+
+// Pixbuf returns the cached scaled pixbuf for the given path if it is still
+// valid (source file unchanged). Only call from the GTK main thread.
+func (c *IconCache) Pixbuf(path string, size int) (*gdk.Pixbuf, bool) {
+	key := iconCacheKey{path: path, size: size}
+
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	if pixbuf, ok := c.pixbufs[key]; ok {
+		return pixbuf, true
+	}
+
+	entry, ok := c.entries[key]
+	if !ok || !entryMatchesFile(entry, path) {
+		return nil, false
+	}
+
+	pixbuf, err := pixbufFromEntry(entry)
+	if err != nil {
+		return nil, false
+	}
+	c.pixbufs[key] = pixbuf
+	return pixbuf, true
+}
+
+// SetImageAsync applies the scaled icon to the image, immediately when
+// cached, otherwise from the decode worker pool once it is ready. The image
+// keeps whatever placeholder it has until then.
+func (c *IconCache) SetImageAsync(path string, size int, image *gtk.Image) {
+	if pixbuf, ok := c.Pixbuf(path, size); ok {
+		image.SetFromPixbuf(pixbuf)
+		return
+	}
+
+	select {
+	case c.tasks <- iconCacheTask{path: path, size: size, image: image}:
+	default:
+		// Queue full: decode synchronously rather than dropping the icon
+		c.completeTask(iconCacheTask{path: path, size: size, image: image})
+	}
+}
+
+// decodeWorker drains the task queue
+func (c *IconCache) decodeWorker() {
+	for task := range c.tasks {
+		c.completeTask(task)
+	}
+}
+
+// completeTask decodes and scales one icon, stores it in the cache, and
+// applies it to the target image on the GTK main thread
+func (c *IconCache) completeTask(task iconCacheTask) {
+	stat, err := os.Stat(task.path)
+	if err != nil {
+		return
+	}
+
+	pixbuf, err := gdk.PixbufNewFromFile(task.path)
+	if err != nil {
+		return
+	}
+	if pixbuf.GetWidth() != task.size || pixbuf.GetHeight() != task.size {
+		scaled, err := pixbuf.ScaleSimple(task.size, task.size, gdk.INTERP_BILINEAR)
+		if err != nil {
+			return
+		}
+		pixbuf = scaled
+	}
+
+	entry := &iconCacheEntry{
+		MTime:     stat.ModTime().Unix(),
+		FileSize:  stat.Size(),
+		Width:     pixbuf.GetWidth(),
+		Height:    pixbuf.GetHeight(),
+		Rowstride: pixbuf.GetRowstride(),
+		HasAlpha:  pixbuf.GetHasAlpha(),
+	}
+	entry.Pixels = append(entry.Pixels, pixbuf.GetPixels()...)
+
+	key := iconCacheKey{path: task.path, size: task.size}
+	c.mu.Lock()
+	c.entries[key] = entry
+	c.pixbufs[key] = pixbuf
+	c.dirty = true
+	c.scheduleSaveLocked()
+	c.mu.Unlock()
+
+	image := task.image
+	glib.IdleAdd(func() {
+		image.SetFromPixbuf(pixbuf)
+	})
+}
+
+// scheduleSaveLocked debounces cache persistence so a burst of decodes
+// results in one write. Caller must hold c.mu.
+func (c *IconCache) scheduleSaveLocked() {
+	if c.saveTimer != nil {
+		c.saveTimer.Reset(2 * time.Second)
+		return
+	}
+	c.saveTimer = time.AfterFunc(2*time.Second, func() {
+		if err := c.saveFile(); err != nil {
+			logger.Warn(fmt.Sprintf("failed to save icon cache: %v\n", err))
+		}
+	})
+}
+
+// entryMatchesFile reports whether the cached entry still matches the
+// source file on disk
+func entryMatchesFile(entry *iconCacheEntry, path string) bool {
+	stat, err := os.Stat(path)
+	if err != nil {
+		return false
+	}
+	return stat.ModTime().Unix() == entry.MTime && stat.Size() == entry.FileSize
+}
+
+// pixbufFromEntry reconstructs a pixbuf from cached pixel data without
+// touching the source file
+func pixbufFromEntry(entry *iconCacheEntry) (*gdk.Pixbuf, error) {
+	pixbuf, err := gdk.PixbufNew(gdk.COLORSPACE_RGB, entry.HasAlpha, 8, entry.Width, entry.Height)
+	if err != nil {
+		return nil, err
+	}
+
+	pixels := pixbuf.GetPixels()
+	if pixbuf.GetRowstride() == entry.Rowstride && len(pixels) >= len(entry.Pixels) {
+		copy(pixels, entry.Pixels)
+		return pixbuf, nil
+	}
+
+	// Rowstride differs: copy row by row
+	rowBytes := entry.Rowstride
+	if pixbuf.GetRowstride() < rowBytes {
+		rowBytes = pixbuf.GetRowstride()
+	}
+	for y := 0; y < entry.Height; y++ {
+		src := entry.Pixels[y*entry.Rowstride:]
+		dst := pixels[y*pixbuf.GetRowstride():]
+		if len(src) < rowBytes || len(dst) < rowBytes {
+			break
+		}
+		copy(dst[:rowBytes], src[:rowBytes])
+	}
+	return pixbuf, nil
+}
+
+// saveFile atomically writes the packed cache file
+func (c *IconCache) saveFile() error {
+	c.mu.Lock()
+	if !c.dirty {
+		c.mu.Unlock()
+		return nil
+	}
+	c.dirty = false
+
+	var buf bytes.Buffer
+	buf.WriteString(iconCacheMagic)
+	binary.Write(&buf, binary.LittleEndian, uint16(iconCacheVersion))
+	binary.Write(&buf, binary.LittleEndian, uint16(0))
+	binary.Write(&buf, binary.LittleEndian, uint32(len(c.entries)))
+
+	for key, entry := range c.entries {
+		binary.Write(&buf, binary.LittleEndian, entry.MTime)
+		binary.Write(&buf, binary.LittleEndian, entry.FileSize)
+		binary.Write(&buf, binary.LittleEndian, int32(key.size))
+		binary.Write(&buf, binary.LittleEndian, int32(entry.Width))
+		binary.Write(&buf, binary.LittleEndian, int32(entry.Height))
+		binary.Write(&buf, binary.LittleEndian, int32(entry.Rowstride))
+		hasAlpha := uint8(0)
+		if entry.HasAlpha {
+			hasAlpha = 1
+		}
+		buf.WriteByte(hasAlpha)
+		buf.Write([]byte{0, 0, 0})
+		binary.Write(&buf, binary.LittleEndian, uint16(len(key.path)))
+		buf.WriteString(key.path)
+		binary.Write(&buf, binary.LittleEndian, uint32(len(entry.Pixels)))
+		buf.Write(entry.Pixels)
+	}
+	c.mu.Unlock()
+
+	path := iconCachePath(c.directory)
+	if err := os.MkdirAll(filepath.Dir(path), 0755); err != nil {
+		return fmt.Errorf("failed to create index directory: %w", err)
+	}
+
+	tmpFile := path + "-tmp"
+	if err := os.WriteFile(tmpFile, buf.Bytes(), 0644); err != nil {
+		return fmt.Errorf("failed to write icon cache: %w", err)
+	}
+	return os.Rename(tmpFile, path)
+}
+
+// loadFile reads the packed cache file, memory-mapped where supported
+func (c *IconCache) loadFile() error {
+	data, closer, err := mapIconCacheFile(iconCachePath(c.directory))
+	if err != nil {
+		return err
+	}
+	defer closer()
+
+	if len(data) < 4+2+2+4 || string(data[:4]) != iconCacheMagic {
+		return fmt.Errorf("invalid icon cache file")
+	}
+
+	offset := 4
+	version := binary.LittleEndian.Uint16(data[offset:])
+	offset += 4 // version + reserved
+	if version != iconCacheVersion {
+		return fmt.Errorf("unsupported icon cache version: %d", version)
+	}
+
+	count := binary.LittleEndian.Uint32(data[offset:])
+	offset += 4
+
+	for i := uint32(0); i < count; i++ {
+		if offset+8+8+4*4+4 > len(data) {
+			return fmt.Errorf("truncated icon cache file")
+		}
+
+		entry := &iconCacheEntry{}
+		entry.MTime = int64(binary.LittleEndian.Uint64(data[offset:]))
+		offset += 8
+		entry.FileSize = int64(binary.LittleEndian.Uint64(data[offset:]))
+		offset += 8
+		size := int(int32(binary.LittleEndian.Uint32(data[offset:])))
+		offset += 4
+		entry.Width = int(int32(binary.LittleEndian.Uint32(data[offset:])))
+		offset += 4
+		entry.Height = int(int32(binary.LittleEndian.Uint32(data[offset:])))
+		offset += 4
+		entry.Rowstride = int(int32(binary.LittleEndian.Uint32(data[offset:])))
+		offset += 4
+		entry.HasAlpha = data[offset] != 0
+		offset += 4 // has alpha + reserved
+
+		if offset+2 > len(data) {
+			return fmt.Errorf("truncated icon cache file")
+		}
+		pathLen := int(binary.LittleEndian.Uint16(data[offset:]))
+		offset += 2
+		if offset+pathLen > len(data) {
+			return fmt.Errorf("truncated icon cache file")
+		}
+		path := string(data[offset : offset+pathLen])
+		offset += pathLen
+
+		if offset+4 > len(data) {
+			return fmt.Errorf("truncated icon cache file")
+		}
+		pixelLen := int(binary.LittleEndian.Uint32(data[offset:]))
+		offset += 4
+		if offset+pixelLen > len(data) {
+			return fmt.Errorf("truncated icon cache file")
+		}
+		// Copy out of the mapping so the pixels stay valid after unmap
+		entry.Pixels = append([]byte(nil), data[offset:offset+pixelLen]...)
+		offset += pixelLen
+
+		c.entries[iconCacheKey{path: path, size: size}] = entry
+	}
+
+	return nil
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+//go:build linux
+
+// Module: icon_cache_mmap_linux.go
+// Description: Memory-maps the packed icon cache file on Linux.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package gui
+
+import (
+	"fmt"
+	"os"
+	"syscall"
+)
+
+// mapIconCacheFile memory-maps the icon cache read-only. The returned closer
+// unmaps the file; the data slice must not be used after calling it.
+func mapIconCacheFile(path string) ([]byte, func(), error) {
+	file, err := os.Open(path)
+	if err != nil {
+		return nil, nil, err
+	}
+	defer file.Close()
+
+	stat, err := file.Stat()
+	if err != nil {
+		return nil, nil, fmt.Errorf("failed to stat icon cache: %w", err)
+	}
+
+	size := stat.Size()
+	if size == 0 {
+		return nil, nil, fmt.Errorf("icon cache is empty: %s", path)
+	}
+
+	data, err := syscall.Mmap(int(file.Fd()), 0, int(size), syscall.PROT_READ, syscall.MAP_PRIVATE)
+	if err != nil {
+		return nil, nil, fmt.Errorf("failed to mmap icon cache: %w", err)
+	}
+
+	return data, func() { syscall.Munmap(data) }, nil
+}
@@ -171,6 +171,8 @@ func (tc *TimeStampChecker) SaveTimestamps(prefix string) error {
 
 // PreloadAppList generates or loads a cached app list
 func PreloadAppList(directory, prefix string) (*PreloadedList, error) {
+	defer api.TraceSpan("preload.list " + prefix)()
+
 	if directory == "" {
 		directory = api.GetPiAppsDir()
 		if directory == "" {
@@ -268,6 +270,15 @@ func generateAppList(config *AppListConfig) (*PreloadedList, error) {
 		Generated: time.Now(),
 	}
 
+	// One shared pass loads the status/description/icon metadata of every
+	// app; regenerating all category lists reuses it, so each file is read
+	// exactly once per cycle (see preload_snapshot.go)
+	snapshot, err := currentAppListSnapshot(config.Directory)
+	if err != nil {
+		logger.Error(api.Tf("failed to load app metadata snapshot: %v\n", err))
+		return nil, fmt.Errorf("failed to load app metadata snapshot: %w", err)
+	}
+
 	// Check for Updates category first (if on main page)
 	if config.Prefix == "" && hasUpdatesAvailable(config.Directory) {
 		updatesItem := AppListItem{
@@ -292,12 +303,7 @@ func generateAppList(config *AppListConfig) (*PreloadedList, error) {
 
 		// Convert to app items
 		for _, app := range deprecatedApps {
-			appItem, err := createDeprecatedAppItem(app, config)
-			if err != nil {
-				logger.Warn(fmt.Sprintf("failed to create deprecated app item for %s: %v\n", app, err))
-				continue
-			}
-			list.Items = append(list.Items, appItem)
+			list.Items = append(list.Items, createDeprecatedAppItem(app, config, snapshot))
 		}
 
 		return list, nil
@@ -311,7 +317,7 @@ func generateAppList(config *AppListConfig) (*PreloadedList, error) {
 	}
 
 	// Separate apps and directories
-	apps, dirs := separateAppsAndDirs(vfiles, config.Directory)
+	apps, dirs := separateAppsAndDirs(vfiles, snapshot)
 
 	// Shuffle if enabled
 	if shouldShuffleList(config.Directory) {
@@ -333,22 +339,12 @@ func generateAppList(config *AppListConfig) (*PreloadedList, error) {
 
 	// Add directory items
 	for _, dir := range dirs {
-		dirItem, err := createDirectoryItem(dir, config)
-		if err != nil {
-			logger.Warn(fmt.Sprintf("failed to create directory item for %s: %v\n", dir, err))
-			continue
-		}
-		list.Items = append(list.Items, dirItem)
+		list.Items = append(list.Items, createDirectoryItem(dir, config, snapshot))
 	}
 
 	// Add app items
 	for _, app := range apps {
-		appItem, err := createAppItem(app, config)
-		if err != nil {
-			logger.Warn(fmt.Sprintf("failed to create app item for %s: %v\n", app, err))
-			continue
-		}
-		list.Items = append(list.Items, appItem)
+		list.Items = append(list.Items, createAppItem(app, config, snapshot))
 	}
 
 	return list, nil
@@ -392,7 +388,7 @@ func getVirtualFileSystem(config *AppListConfig) ([]string, error) {
 }
 
 // separateAppsAndDirs separates apps from directories
-func separateAppsAndDirs(vfiles []string, directory string) (apps []string, dirs []string) {
+func separateAppsAndDirs(vfiles []string, snapshot *appListSnapshot) (apps []string, dirs []string) {
 	// Remove apps within categories - show this layer only
 	var processed []string
 	for _, vfile := range vfiles {
@@ -410,13 +406,6 @@ func separateAppsAndDirs(vfiles []string, directory string) (apps []string, dirs
 	// Remove duplicates
 	processed = removeDuplicates(processed)
 
-	// Get CPU installable apps for filtering - this ensures architecture compatibility
-	cpuInstallableApps, err := api.ListApps("cpu_installable")
-	if err != nil {
-		logger.Warn(api.Tf("failed to get CPU installable apps: %v\n", err))
-		cpuInstallableApps = []string{}
-	}
-
 	// Separate apps and directories
 	for _, item := range processed {
 		if strings.HasSuffix(item, "/") {
@@ -424,22 +413,22 @@ func separateAppsAndDirs(vfiles []string, directory string) (apps []string, dirs
 			dirs = append(dirs, strings.TrimSuffix(item, "/"))
 		} else {
 			// It's an app, check if it's CPU installable (compatible with current architecture)
-			if contains(cpuInstallableApps, item) {
+			if snapshot.cpuInstallable[item] {
 				apps = append(apps, item)
 			}
-			// If not in cpuInstallableApps, the app is not compatible with current architecture and will be hidden
+			// If not CPU installable, the app is not compatible with current architecture and will be hidden
 		}
 	}
 
 	return apps, dirs
 }
 
-// createDirectoryItem creates an AppListItem for a directory/category
-func createDirectoryItem(dir string, config *AppListConfig) (AppListItem, error) {
+// createDirectoryItem builds the AppListItem for a directory/category from
+// the snapshot, without touching the filesystem
+func createDirectoryItem(dir string, config *AppListConfig, snapshot *appListSnapshot) AppListItem {
 	var iconPath string
-	categoryIconPath := filepath.Join(config.Directory, "icons", "categories", dir+".png")
-	if appListFileExists(categoryIconPath) {
-		iconPath = categoryIconPath
+	if snapshot.categoryIcons[dir] {
+		iconPath = filepath.Join(config.Directory, "icons", "categories", dir+".png")
 	} else {
 		iconPath = filepath.Join(config.Directory, "icons", "categories", "default.png")
 	}
@@ -459,7 +448,7 @@ func createDirectoryItem(dir string, config *AppListConfig) (AppListItem, error)
 		Path:        path,
 		Description: description,
 		IconPath:    iconPath,
-	}, nil
+	}
 }
 
 // getDeprecatedApps returns a list of all deprecated apps
@@ -488,47 +477,10 @@ func getDeprecatedApps(directory string) ([]string, error) {
 	return deprecatedApps, nil
 }
 
-// createDeprecatedAppItem creates an AppListItem for a deprecated app
-func createDeprecatedAppItem(app string, config *AppListConfig) (AppListItem, error) {
-	// Get app status (deprecated apps can still be installed)
-	status, err := api.GetAppStatus(app)
-	if err != nil {
-		status = ""
-	}
-
-	// Get description from metadata or use default
-	deprecatedDir := filepath.Join(config.Directory, "data", "deprecated-apps", app)
-	metadataFile := filepath.Join(deprecatedDir, "metadata")
-	description := api.T("This app has been deprecated and removed from Pi-Apps.")
-
-	if metadataData, err := os.ReadFile(metadataFile); err == nil {
-		// Parse metadata to get message if available
-		lines := strings.Split(string(metadataData), "\n")
-		for _, line := range lines {
-			if strings.HasPrefix(line, "message=") {
-				message := strings.TrimPrefix(line, "message=")
-				if message != "" {
-					description = message
-				}
-				break
-			}
-		}
-	}
-
-	// Get app icon from stored location
-	iconPath := api.GetDeprecatedAppIcon(app)
-	if iconPath == "" {
-		// Fallback to default icon
-		iconPath = filepath.Join(config.Directory, "icons", "none-24.png")
-	}
-
-	// Use 24px version if available, otherwise use what we have
-	if strings.Contains(iconPath, "icon-64.png") {
-		icon24Path := strings.Replace(iconPath, "icon-64.png", "icon-24.png", 1)
-		if appListFileExists(icon24Path) {
-			iconPath = icon24Path
-		}
-	}
+// createDeprecatedAppItem builds the AppListItem for a deprecated app from
+// the snapshot's stored metadata
+func createDeprecatedAppItem(app string, config *AppListConfig, snapshot *appListSnapshot) AppListItem {
+	facts := snapshot.appFactsFor(config.Directory, app)
 
 	// Use the prefix from config if available, otherwise default to Deprecated
 	var path string
@@ -542,40 +494,20 @@ func createDeprecatedAppItem(app string, config *AppListConfig) (AppListItem, er
 		Type:        "app",
 		Name:        app,
 		Path:        path,
-		Description: description,
-		IconPath:    iconPath,
-		Status:      status,
-	}, nil
-}
-
-// createAppItem creates an AppListItem for an app
-func createAppItem(app string, config *AppListConfig) (AppListItem, error) {
-	// Check if this is a deprecated app - if so, use deprecated app item creation
-	if api.IsDeprecatedApp(app) {
-		return createDeprecatedAppItem(app, config)
+		Description: facts.Description,
+		IconPath:    facts.IconPath,
+		Status:      facts.Status,
 	}
+}
 
-	// Get app status
-	status, err := api.GetAppStatus(app)
-	if err != nil {
-		status = ""
-	}
+// createAppItem builds the AppListItem for an app from the snapshot; the
+// status, description and icon reads happened in the shared snapshot pass
+func createAppItem(app string, config *AppListConfig, snapshot *appListSnapshot) AppListItem {
+	facts := snapshot.appFactsFor(config.Directory, app)
 
-	// Get app description (first line only, like the original bash script)
-	descFile := filepath.Join(config.Directory, "apps", app, "description")
-	description := api.T("Description unavailable")
-	if descData, err := os.ReadFile(descFile); err == nil {
-		// Split into lines and take only the first line (matching bash read -r behavior)
-		lines := strings.Split(string(descData), "\n")
-		if len(lines) > 0 && strings.TrimSpace(lines[0]) != "" {
-			description = strings.TrimSpace(lines[0])
-		}
-	}
-
-	// Get app icon
-	iconPath := filepath.Join(config.Directory, "apps", app, "icon-24.png")
-	if !appListFileExists(iconPath) {
-		iconPath = filepath.Join(config.Directory, "icons", "none-24.png")
+	// Deprecated apps carry their stored metadata and Deprecated/ path
+	if facts.Deprecated {
+		return createDeprecatedAppItem(app, config, snapshot)
 	}
 
 	var path string
@@ -589,10 +521,10 @@ func createAppItem(app string, config *AppListConfig) (AppListItem, error) {
 		Type:        "app",
 		Name:        app,
 		Path:        path,
-		Description: description,
-		IconPath:    iconPath,
-		Status:      status,
-	}, nil
+		Description: facts.Description,
+		IconPath:    facts.IconPath,
+		Status:      facts.Status,
+	}
 }
 
 // Helper functions
@@ -760,15 +692,6 @@ func appListFileExists(path string) bool {
 	return err == nil
 }
 
-func contains(slice []string, item string) bool {
-	for _, s := range slice {
-		if s == item {
-			return true
-		}
-	}
-	return false
-}
-
 func removeDuplicates(slice []string) []string {
 	keys := make(map[string]bool)
 	var result []string
@@ -0,0 +1,142 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: preload_bench_test.go
+// Description: Benchmarks for PreloadAppList against a synthetic apps tree,
+// covering both the cached-list path and full regeneration. Run them with
+// `make bench`; sizes default to 100/500/2000 apps, overridable through the
+// PI_APPS_BENCH_SIZES environment variable (comma-separated counts).
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package gui
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"testing"
+)
+
+// preloadBenchSizes returns the synthetic tree sizes to benchmark against
+func preloadBenchSizes() []int {
+	if env := os.Getenv("PI_APPS_BENCH_SIZES"); env != "" {
+		var sizes []int
+		for _, field := range strings.Split(env, ",") {
+			if n, err := strconv.Atoi(strings.TrimSpace(field)); err == nil && n > 0 {
+				sizes = append(sizes, n)
+			}
+		}
+		if len(sizes) > 0 {
+			return sizes
+		}
+	}
+	return []int{100, 500, 2000}
+}
+
+// makePreloadBenchTree builds a synthetic Pi-Apps directory with n apps,
+// each carrying the description, status and icon files the preload reads
+func makePreloadBenchTree(b testing.TB, n int) string {
+	b.Helper()
+	dir := b.TempDir()
+
+	for _, sub := range []string{
+		filepath.Join("apps"),
+		filepath.Join("update", "pi-apps", "apps"),
+		filepath.Join("data", "status"),
+		filepath.Join("data", "settings"),
+		filepath.Join("data", "categories"),
+		filepath.Join("icons", "categories"),
+	} {
+		if err := os.MkdirAll(filepath.Join(dir, sub), 0755); err != nil {
+			b.Fatal(err)
+		}
+	}
+
+	// Marker files checked by the Pi-Apps directory validation
+	for _, marker := range []string{"api", "gui"} {
+		if err := os.WriteFile(filepath.Join(dir, marker), []byte("#!/bin/sh\n"), 0755); err != nil {
+			b.Fatal(err)
+		}
+	}
+
+	var overrides strings.Builder
+	for i := 0; i < n; i++ {
+		app := fmt.Sprintf("Bench App %04d", i)
+		appDir := filepath.Join(dir, "apps", app)
+		if err := os.MkdirAll(appDir, 0755); err != nil {
+			b.Fatal(err)
+		}
+
+		description := fmt.Sprintf("Synthetic benchmark app number %04d with a realistic description line.\nA second line that listing code must skip.\n", i)
+		os.WriteFile(filepath.Join(appDir, "description"), []byte(description), 0644)
+		os.WriteFile(filepath.Join(appDir, "icon-24.png"), make([]byte, 600), 0644)
+		os.WriteFile(filepath.Join(appDir, "install-64"), []byte("#!/bin/bash\ntrue\n"), 0755)
+		if i%2 == 0 {
+			os.WriteFile(filepath.Join(dir, "data", "status", app), []byte("installed"), 0644)
+		}
+
+		os.MkdirAll(filepath.Join(dir, "update", "pi-apps", "apps", app), 0755)
+		overrides.WriteString(app + "|Tools\n")
+	}
+	if err := os.WriteFile(filepath.Join(dir, "data", "category-overrides"), []byte(overrides.String()), 0644); err != nil {
+		b.Fatal(err)
+	}
+
+	return dir
+}
+
+func BenchmarkPreloadAppListCached(b *testing.B) {
+	for _, size := range preloadBenchSizes() {
+		dir := makePreloadBenchTree(b, size)
+		b.Run(fmt.Sprintf("%d", size), func(b *testing.B) {
+			b.Setenv("PI_APPS_DIR", dir)
+			// Warm the cached list and timestamps
+			if _, err := PreloadAppList(dir, "Tools"); err != nil {
+				b.Fatal(err)
+			}
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err := PreloadAppList(dir, "Tools"); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+func BenchmarkPreloadAppListGenerate(b *testing.B) {
+	for _, size := range preloadBenchSizes() {
+		dir := makePreloadBenchTree(b, size)
+		b.Run(fmt.Sprintf("%d", size), func(b *testing.B) {
+			b.Setenv("PI_APPS_DIR", dir)
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				// Dropping the cached lists forces a full regeneration
+				// (the shared metadata snapshot stays warm, as it does
+				// for the daemon's per-category lists)
+				b.StopTimer()
+				os.RemoveAll(filepath.Join(dir, "data", "preload"))
+				b.StartTimer()
+				if _, err := PreloadAppList(dir, "Tools"); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
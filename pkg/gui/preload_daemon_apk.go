@@ -112,6 +112,15 @@ func (d *PreloadDaemon) IsRunning() bool {
 func (d *PreloadDaemon) run(ctx context.Context) {
 	defer d.wg.Done()
 
+	// Prefer event-driven invalidation: when filesystem watches are
+	// available the kernel wakes the daemon only when a monitored tree
+	// actually changes, instead of walking every entry on a timer
+	if watcher, err := newPreloadWatcher(d.directory); err == nil {
+		defer watcher.Close()
+		d.runWatchLoop(ctx, watcher)
+		return
+	}
+
 	ticker := time.NewTicker(d.refreshPeriod)
 	defer ticker.Stop()
 
@@ -0,0 +1,251 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: preload_snapshot.go
+// Description: Shared per-app metadata snapshot for app list generation.
+// Regenerating the category lists used to re-read each app's status,
+// description and icon once per list; the snapshot loads them all in a
+// single pass, is reused for every list of the same regeneration cycle
+// (a stat-level fingerprint detects when the source files change), and
+// turns the per-item builders in preload.go into in-memory transforms.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package gui
+
+import (
+	"fmt"
+	"io/fs"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+
+	"github.com/pi-apps-go/pi-apps/pkg/api"
+)
+
+// appFacts holds everything createAppItem needs to know about one app
+type appFacts struct {
+	Status      string
+	Description string
+	IconPath    string
+	Deprecated  bool
+}
+
+// appListSnapshot is the metadata for all apps, loaded once per regeneration
+// cycle. The facts live in one backing slice; index maps app names into it.
+type appListSnapshot struct {
+	facts          []appFacts
+	index          map[string]int
+	cpuInstallable map[string]bool
+	categoryIcons  map[string]bool // icons/categories/<name>.png present
+	fingerprint    string
+}
+
+var (
+	appListSnapshotMu  sync.Mutex
+	appListSnapshotCur *appListSnapshot
+)
+
+// currentAppListSnapshot returns the cached snapshot, rebuilding it only when
+// the directories it is derived from have changed since it was taken
+func currentAppListSnapshot(directory string) (*appListSnapshot, error) {
+	fingerprint := snapshotFingerprint(directory)
+
+	appListSnapshotMu.Lock()
+	defer appListSnapshotMu.Unlock()
+
+	if appListSnapshotCur != nil && appListSnapshotCur.fingerprint == fingerprint {
+		return appListSnapshotCur, nil
+	}
+
+	snapshot, err := buildAppListSnapshot(directory, fingerprint)
+	if err != nil {
+		return nil, err
+	}
+	appListSnapshotCur = snapshot
+	return snapshot, nil
+}
+
+// snapshotFingerprint stats the directories the snapshot is built from, in
+// the same style as TimeStampChecker; it reads no file contents
+func snapshotFingerprint(directory string) string {
+	dirs := []string{
+		filepath.Join(directory, "apps"),
+		filepath.Join(directory, "data", "status"),
+		filepath.Join(directory, "data", "deprecated-apps"),
+		filepath.Join(directory, "icons", "categories"),
+	}
+
+	var result strings.Builder
+	for _, dir := range dirs {
+		stat, err := os.Stat(dir)
+		if err != nil {
+			result.WriteString(fmt.Sprintf("%s 0\n", dir))
+			continue
+		}
+
+		latest := stat.ModTime().Unix()
+		filepath.WalkDir(dir, func(path string, d fs.DirEntry, err error) error {
+			if err != nil {
+				return nil
+			}
+			if info, err := d.Info(); err == nil && info.ModTime().Unix() > latest {
+				latest = info.ModTime().Unix()
+			}
+			return nil
+		})
+		result.WriteString(fmt.Sprintf("%s %d %d\n", dir, stat.ModTime().Unix(), latest))
+	}
+	return result.String()
+}
+
+// buildAppListSnapshot performs the single pass over every app's status,
+// description and icon metadata
+func buildAppListSnapshot(directory, fingerprint string) (*appListSnapshot, error) {
+	allApps, err := api.ListApps("all")
+	if err != nil {
+		return nil, fmt.Errorf("failed to list apps: %w", err)
+	}
+
+	deprecatedApps, err := getDeprecatedApps(directory)
+	if err != nil {
+		logger.Warn(api.Tf("failed to get deprecated apps: %v\n", err))
+		deprecatedApps = []string{}
+	}
+
+	snapshot := &appListSnapshot{
+		index:          make(map[string]int, len(allApps)+len(deprecatedApps)),
+		cpuInstallable: make(map[string]bool),
+		categoryIcons:  make(map[string]bool),
+		fingerprint:    fingerprint,
+	}
+	snapshot.facts = make([]appFacts, 0, len(allApps)+len(deprecatedApps))
+
+	add := func(app string, facts appFacts) {
+		if _, ok := snapshot.index[app]; ok {
+			return
+		}
+		snapshot.index[app] = len(snapshot.facts)
+		snapshot.facts = append(snapshot.facts, facts)
+	}
+
+	// Deprecated apps first: an app present in both listings must use its
+	// deprecated metadata, matching the old createAppItem behavior
+	for _, app := range deprecatedApps {
+		add(app, loadDeprecatedAppFacts(directory, app))
+	}
+	for _, app := range allApps {
+		if api.IsDeprecatedApp(app) {
+			add(app, loadDeprecatedAppFacts(directory, app))
+			continue
+		}
+		add(app, loadAppFacts(directory, app))
+	}
+
+	// Architecture compatibility, previously re-queried per category list
+	cpuInstallableApps, err := api.ListApps("cpu_installable")
+	if err != nil {
+		logger.Warn(api.Tf("failed to get CPU installable apps: %v\n", err))
+		cpuInstallableApps = []string{}
+	}
+	for _, app := range cpuInstallableApps {
+		snapshot.cpuInstallable[app] = true
+	}
+
+	// Which categories have their own icon file
+	if entries, err := os.ReadDir(filepath.Join(directory, "icons", "categories")); err == nil {
+		for _, entry := range entries {
+			if name, ok := strings.CutSuffix(entry.Name(), ".png"); ok {
+				snapshot.categoryIcons[name] = true
+			}
+		}
+	}
+
+	return snapshot, nil
+}
+
+// loadAppFacts reads the status, description and icon of one regular app
+func loadAppFacts(directory, app string) appFacts {
+	status, err := api.GetAppStatus(app)
+	if err != nil {
+		status = ""
+	}
+
+	// First line of the description file, matching bash `read -r`
+	description := api.T("Description unavailable")
+	if descData, err := os.ReadFile(filepath.Join(directory, "apps", app, "description")); err == nil {
+		lines := strings.Split(string(descData), "\n")
+		if len(lines) > 0 && strings.TrimSpace(lines[0]) != "" {
+			description = strings.TrimSpace(lines[0])
+		}
+	}
+
+	iconPath := filepath.Join(directory, "apps", app, "icon-24.png")
+	if !appListFileExists(iconPath) {
+		iconPath = filepath.Join(directory, "icons", "none-24.png")
+	}
+
+	return appFacts{Status: status, Description: description, IconPath: iconPath}
+}
+
+// loadDeprecatedAppFacts reads the stored metadata of one deprecated app
+func loadDeprecatedAppFacts(directory, app string) appFacts {
+	// Deprecated apps can still be installed, so they keep a real status
+	status, err := api.GetAppStatus(app)
+	if err != nil {
+		status = ""
+	}
+
+	description := api.T("This app has been deprecated and removed from Pi-Apps.")
+	metadataFile := filepath.Join(directory, "data", "deprecated-apps", app, "metadata")
+	if metadataData, err := os.ReadFile(metadataFile); err == nil {
+		for _, line := range strings.Split(string(metadataData), "\n") {
+			if message, ok := strings.CutPrefix(line, "message="); ok {
+				if message != "" {
+					description = message
+				}
+				break
+			}
+		}
+	}
+
+	iconPath := api.GetDeprecatedAppIcon(app)
+	if iconPath == "" {
+		iconPath = filepath.Join(directory, "icons", "none-24.png")
+	}
+
+	// Prefer the 24px version if available
+	if strings.Contains(iconPath, "icon-64.png") {
+		icon24Path := strings.Replace(iconPath, "icon-64.png", "icon-24.png", 1)
+		if appListFileExists(icon24Path) {
+			iconPath = icon24Path
+		}
+	}
+
+	return appFacts{Status: status, Description: description, IconPath: iconPath, Deprecated: true}
+}
+
+// appFactsFor returns the facts for one app, falling back to a direct probe
+// for apps that appear in a category file but not in the app listings
+func (s *appListSnapshot) appFactsFor(directory, app string) appFacts {
+	if i, ok := s.index[app]; ok {
+		return s.facts[i]
+	}
+	if api.IsDeprecatedApp(app) {
+		return loadDeprecatedAppFacts(directory, app)
+	}
+	return loadAppFacts(directory, app)
+}
@@ -0,0 +1,181 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: preload_watch.go
+// Description: Event-driven invalidation loop for the preload daemon. When
+// filesystem watches are available the daemon reacts to changes in the
+// monitored trees and regenerates only the affected category lists instead
+// of re-walking every directory on a timer.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package gui
+
+import (
+	"context"
+	"path/filepath"
+	"strings"
+	"time"
+
+	"github.com/pi-apps-go/pi-apps/pkg/api"
+)
+
+// watchDebounce is how long the watch loop coalesces events before
+// refreshing, so bursts (e.g. an app install touching many files) trigger a
+// single regeneration.
+const watchDebounce = 500 * time.Millisecond
+
+// runWatchLoop is the event-driven alternative to the timed refresh loop.
+// It blocks until the daemon is stopped, regenerating only the category
+// lists affected by each batch of filesystem events.
+func (d *PreloadDaemon) runWatchLoop(ctx context.Context, watcher *preloadWatcher) {
+	// Run one full refresh at startup so the lists exist before any event
+	d.refreshAll()
+
+	var pending []string
+	var debounce *time.Timer
+	var debounceC <-chan time.Time
+
+	for {
+		select {
+		case <-ctx.Done():
+			logger.Info(api.T("Preload daemon stopped due to context cancellation"))
+			return
+		case <-d.stopChan:
+			logger.Info(api.T("Preload daemon stopped"))
+			return
+		case path, ok := <-watcher.Events:
+			if !ok {
+				// Watcher died (e.g. watch limit exhausted); the caller
+				// falls back to the timed loop
+				logger.Warn(api.T("Preload watcher closed, falling back to timed refresh"))
+				d.runTimedLoop(ctx)
+				return
+			}
+			pending = append(pending, path)
+			if debounce == nil {
+				debounce = time.NewTimer(watchDebounce)
+				debounceC = debounce.C
+			} else {
+				debounce.Reset(watchDebounce)
+			}
+		case <-debounceC:
+			debounce = nil
+			debounceC = nil
+			changed := pending
+			pending = nil
+			d.refreshChangedPaths(changed)
+		}
+	}
+}
+
+// runTimedLoop is the original timer-driven refresh loop, used when watches
+// are unavailable or stop working
+func (d *PreloadDaemon) runTimedLoop(ctx context.Context) {
+	ticker := time.NewTicker(d.refreshPeriod)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-ctx.Done():
+			logger.Info(api.T("Preload daemon stopped due to context cancellation"))
+			return
+		case <-d.stopChan:
+			logger.Info(api.T("Preload daemon stopped"))
+			return
+		case <-ticker.C:
+			d.refreshAll()
+		}
+	}
+}
+
+// refreshChangedPaths maps a batch of changed paths to the category lists
+// they affect and regenerates just those. Changes that can't be attributed
+// to a single app (settings, icons, scripts) fall back to a full refresh.
+func (d *PreloadDaemon) refreshChangedPaths(paths []string) {
+	// Package app status depends on the dpkg/apt state, refresh it first
+	// just like the timed loop does
+	if err := d.refreshPackageAppStatus(); err != nil {
+		logger.Warn(api.Tf("failed to refresh package app status: %v\n", err))
+	}
+
+	appsDir := filepath.Join(d.directory, "apps")
+	statusDir := filepath.Join(d.directory, "data", "status")
+
+	// Collect the apps affected by this batch; any path outside the per-app
+	// trees dirties everything
+	changedApps := make(map[string]bool)
+	for _, path := range paths {
+		switch {
+		case strings.HasPrefix(path, appsDir+string(filepath.Separator)):
+			relative := strings.TrimPrefix(path, appsDir+string(filepath.Separator))
+			changedApps[strings.SplitN(relative, string(filepath.Separator), 2)[0]] = true
+		case strings.HasPrefix(path, statusDir+string(filepath.Separator)):
+			changedApps[filepath.Base(path)] = true
+		default:
+			logger.Debug(api.Tf("Preload watcher: change outside app trees (%s), refreshing all\n", path))
+			d.refreshAll()
+			return
+		}
+	}
+
+	// Map affected apps to their categories
+	dirtyFolders := map[string]bool{
+		// The special folders aggregate every app, so any app change
+		// dirties them
+		"All Apps":  true,
+		"Installed": true,
+		"Packages":  true,
+	}
+
+	categories := make(map[string]string)
+	if assignments, err := api.ReadCategoryFiles(d.directory); err == nil {
+		for _, assignment := range assignments {
+			parts := strings.SplitN(assignment, "|", 2)
+			if len(parts) == 2 {
+				categories[parts[0]] = parts[1]
+			}
+		}
+	}
+
+	for app := range changedApps {
+		if category := categories[app]; category != "" && category != "hidden" {
+			dirtyFolders[category] = true
+		}
+	}
+
+	logger.Info(api.Tf("Preload-daemon refreshing %d changed folder(s)...\n", len(dirtyFolders)))
+
+	for folder := range dirtyFolders {
+		if err := d.preloadFolder(folder); err != nil {
+			logger.Warn(api.Tf("failed to preload folder '%s': %v\n", folder, err))
+		}
+	}
+
+	logger.Info(api.T("Preload-daemon done"))
+}
+
+// preloadWatchRoots returns the directory trees the watcher subscribes to,
+// matching the directories monitored by TimeStampChecker
+func preloadWatchRoots(directory string) []string {
+	return []string{
+		filepath.Join(directory, "apps"),
+		filepath.Join(directory, "data", "settings"),
+		filepath.Join(directory, "data", "status"),
+		filepath.Join(directory, "data", "categories"),
+		filepath.Join(directory, "etc"),
+		filepath.Join(directory, "icons", "categories"),
+	}
+}
@@ -0,0 +1,181 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+//go:build linux
+
+// Module: preload_watch_linux.go
+// Description: inotify-based filesystem watcher for the preload daemon.
+// Subscribes to the monitored trees recursively so the daemon is woken by
+// the kernel instead of polling full-tree mtimes.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package gui
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"sync"
+	"syscall"
+	"unsafe"
+)
+
+// preloadWatcher delivers the paths of changed files on its Events channel.
+// The channel is closed if the watcher fails irrecoverably.
+type preloadWatcher struct {
+	Events chan string
+
+	fd      int
+	mu      sync.Mutex
+	watches map[int]string // watch descriptor -> directory path
+	closed  bool
+}
+
+// Events that mean a file or directory changed in a way that can affect the
+// generated lists
+const watchMask = syscall.IN_CREATE | syscall.IN_DELETE | syscall.IN_CLOSE_WRITE |
+	syscall.IN_MOVED_FROM | syscall.IN_MOVED_TO | syscall.IN_ATTRIB
+
+// newPreloadWatcher sets up inotify watches on the monitored trees. Returns
+// an error when inotify is unavailable (e.g. watch limit reached), in which
+// case the daemon falls back to the timed full-tree walk.
+func newPreloadWatcher(directory string) (*preloadWatcher, error) {
+	fd, err := syscall.InotifyInit1(syscall.IN_CLOEXEC)
+	if err != nil {
+		return nil, fmt.Errorf("inotify unavailable: %w", err)
+	}
+
+	watcher := &preloadWatcher{
+		Events:  make(chan string, 64),
+		fd:      fd,
+		watches: make(map[int]string),
+	}
+
+	for _, root := range preloadWatchRoots(directory) {
+		if err := watcher.watchTree(root); err != nil {
+			watcher.Close()
+			return nil, err
+		}
+	}
+
+	go watcher.readEvents()
+
+	return watcher, nil
+}
+
+// watchTree adds watches for a directory and all its subdirectories.
+// Missing roots are skipped; they are re-checked on a full refresh.
+func (w *preloadWatcher) watchTree(root string) error {
+	info, err := os.Stat(root)
+	if err != nil || !info.IsDir() {
+		return nil
+	}
+
+	return filepath.WalkDir(root, func(path string, d os.DirEntry, err error) error {
+		if err != nil {
+			return nil // Skip unreadable entries
+		}
+		if !d.IsDir() {
+			return nil
+		}
+		return w.addWatch(path)
+	})
+}
+
+// addWatch registers one directory with inotify
+func (w *preloadWatcher) addWatch(path string) error {
+	wd, err := syscall.InotifyAddWatch(w.fd, path, watchMask)
+	if err != nil {
+		return fmt.Errorf("failed to watch %s: %w", path, err)
+	}
+
+	w.mu.Lock()
+	w.watches[wd] = path
+	w.mu.Unlock()
+	return nil
+}
+
+// readEvents reads raw inotify events and forwards changed paths
+func (w *preloadWatcher) readEvents() {
+	defer close(w.Events)
+
+	buf := make([]byte, 64*(syscall.SizeofInotifyEvent+syscall.NAME_MAX+1))
+	for {
+		n, err := syscall.Read(w.fd, buf)
+		if err != nil {
+			return // fd closed or irrecoverable error
+		}
+
+		offset := 0
+		for offset+syscall.SizeofInotifyEvent <= n {
+			event := (*syscall.InotifyEvent)(unsafe.Pointer(&buf[offset]))
+			nameLen := int(event.Len)
+
+			name := ""
+			if nameLen > 0 {
+				raw := buf[offset+syscall.SizeofInotifyEvent : offset+syscall.SizeofInotifyEvent+nameLen]
+				// The name is NUL-padded to alignment
+				for i, b := range raw {
+					if b == 0 {
+						raw = raw[:i]
+						break
+					}
+				}
+				name = string(raw)
+			}
+			offset += syscall.SizeofInotifyEvent + nameLen
+
+			w.mu.Lock()
+			dir, known := w.watches[int(event.Wd)]
+			w.mu.Unlock()
+			if !known {
+				continue
+			}
+
+			path := dir
+			if name != "" {
+				path = filepath.Join(dir, name)
+			}
+
+			// Newly created subdirectories (e.g. a freshly installed app's
+			// folder) need their own watch
+			if event.Mask&syscall.IN_ISDIR != 0 && event.Mask&(syscall.IN_CREATE|syscall.IN_MOVED_TO) != 0 {
+				if err := w.watchTree(path); err != nil {
+					logger.Debug(fmt.Sprintf("failed to watch new directory %s: %v\n", path, err))
+				}
+			}
+
+			select {
+			case w.Events <- path:
+			default:
+				// Drop events rather than blocking the reader; the
+				// debounced refresh will still pick up the change via the
+				// events that did get through
+			}
+		}
+	}
+}
+
+// Close stops the watcher and releases the inotify descriptor
+func (w *preloadWatcher) Close() {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+	if w.closed {
+		return
+	}
+	w.closed = true
+	syscall.Close(w.fd)
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+//go:build !linux
+
+// Module: preload_watch_other.go
+// Description: Stub watcher for platforms without inotify; the preload
+// daemon falls back to the timed full-tree walk there.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package gui
+
+import "fmt"
+
+// preloadWatcher is unavailable on non-Linux platforms
+type preloadWatcher struct {
+	Events chan string
+}
+
+// newPreloadWatcher always fails on platforms without inotify so the daemon
+// uses the timed refresh loop
+func newPreloadWatcher(directory string) (*preloadWatcher, error) {
+	return nil, fmt.Errorf("filesystem watches are not supported on this platform")
+}
+
+// Close is a no-op on the stub watcher
+func (w *preloadWatcher) Close() {}
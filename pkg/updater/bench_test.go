@@ -0,0 +1,104 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: bench_test.go
+// Description: Benchmark for GetUpdatableFiles over a synthetic main and
+// update tree pair. Run it with `make bench`; sizes default to 100/500/2000
+// files, overridable through the PI_APPS_BENCH_SIZES environment variable
+// (comma-separated counts).
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package updater
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"testing"
+)
+
+// updaterBenchSizes returns the synthetic tree sizes to benchmark against
+func updaterBenchSizes() []int {
+	if env := os.Getenv("PI_APPS_BENCH_SIZES"); env != "" {
+		var sizes []int
+		for _, field := range strings.Split(env, ",") {
+			if n, err := strconv.Atoi(strings.TrimSpace(field)); err == nil && n > 0 {
+				sizes = append(sizes, n)
+			}
+		}
+		if len(sizes) > 0 {
+			return sizes
+		}
+	}
+	return []int{100, 500, 2000}
+}
+
+// makeUpdaterBenchTree builds a main directory and its update/pi-apps copy
+// with n files, every tenth of which differs upstream
+func makeUpdaterBenchTree(b testing.TB, n int) string {
+	b.Helper()
+	dir := b.TempDir()
+
+	updateDir := filepath.Join(dir, "update", "pi-apps")
+	for _, sub := range []string{"etc", filepath.Join("update", "pi-apps", "etc")} {
+		if err := os.MkdirAll(filepath.Join(dir, sub), 0755); err != nil {
+			b.Fatal(err)
+		}
+	}
+
+	// Marker files checked by the Pi-Apps directory validation
+	for _, marker := range []string{"api", "gui"} {
+		os.WriteFile(filepath.Join(dir, marker), []byte("#!/bin/sh\n"), 0755)
+		os.WriteFile(filepath.Join(updateDir, marker), []byte("#!/bin/sh\n"), 0755)
+	}
+
+	for i := 0; i < n; i++ {
+		name := filepath.Join("etc", fmt.Sprintf("bench-file-%04d", i))
+		content := fmt.Sprintf("synthetic file %04d with some benchmark content\n", i)
+		if err := os.WriteFile(filepath.Join(dir, name), []byte(content), 0644); err != nil {
+			b.Fatal(err)
+		}
+		if i%10 == 0 {
+			content += "changed upstream\n"
+		}
+		if err := os.WriteFile(filepath.Join(updateDir, name), []byte(content), 0644); err != nil {
+			b.Fatal(err)
+		}
+	}
+
+	return dir
+}
+
+func BenchmarkGetUpdatableFiles(b *testing.B) {
+	for _, size := range updaterBenchSizes() {
+		dir := makeUpdaterBenchTree(b, size)
+		b.Run(fmt.Sprintf("%d", size), func(b *testing.B) {
+			b.Setenv("PI_APPS_DIR", dir)
+			u, err := New(dir, ModeCLI, SpeedNormal)
+			if err != nil {
+				b.Fatal(err)
+			}
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if _, err := u.GetUpdatableFiles(); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
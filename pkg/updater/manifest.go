@@ -0,0 +1,238 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: manifest.go
+// Description: Content-hash manifests for update checks. Each tree (the
+// local install and the cloned update) gets a manifest of
+// (path, size, mtime, sha256) maintained incrementally in
+// data/update-status, so a check only re-hashes files whose size or mtime
+// changed and the comparison itself is an in-memory diff of two manifests
+// instead of reading every file in both trees.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package updater
+
+import (
+	"crypto/sha1"
+	"crypto/sha256"
+	"encoding/gob"
+	"encoding/hex"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"strings"
+)
+
+// fileManifests returns the manifests used for the file-level update check,
+// covering the same paths listAllFiles walked (apps are handled separately)
+func (u *Updater) fileManifests() (local, update *treeManifest, err error) {
+	local, err = u.loadTreeManifest(u.directory, "manifest-local", func(relPath string) bool {
+		return strings.HasPrefix(relPath, ".git/") ||
+			strings.HasPrefix(relPath, "apps/") ||
+			strings.HasPrefix(relPath, "update/") ||
+			strings.HasPrefix(relPath, "data/") ||
+			strings.HasPrefix(relPath, "logs/")
+	})
+	if err != nil {
+		return nil, nil, err
+	}
+
+	update, err = u.loadTreeManifest(filepath.Join(u.directory, "update", "pi-apps"), "manifest-update", func(relPath string) bool {
+		return strings.HasPrefix(relPath, ".git/") ||
+			strings.HasPrefix(relPath, "apps/") ||
+			strings.HasPrefix(relPath, "data/")
+	})
+	if err != nil {
+		return nil, nil, err
+	}
+	return local, update, nil
+}
+
+// appManifests returns the manifests of the local and update apps trees,
+// used for the per-app directory comparison
+func (u *Updater) appManifests() (local, update *treeManifest, err error) {
+	local, err = u.loadTreeManifest(filepath.Join(u.directory, "apps"), "manifest-local-apps", nil)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	update, err = u.loadTreeManifest(filepath.Join(u.directory, "update", "pi-apps", "apps"), "manifest-update-apps", nil)
+	if err != nil {
+		return nil, nil, err
+	}
+	return local, update, nil
+}
+
+// manifestEntry describes one file in a tree manifest
+type manifestEntry struct {
+	Size    int64
+	MTime   int64 // modification time in nanoseconds
+	Hash    string
+	GitHash string // git blob ID, diffed against ls-tree output (partial.go)
+}
+
+// treeManifest maps tree-relative paths to their content hashes
+type treeManifest struct {
+	Entries map[string]manifestEntry
+}
+
+// loadTreeManifest builds the manifest for the tree rooted at root, reusing
+// hashes from the cached manifest (named cacheName in data/update-status)
+// for files whose size and mtime are unchanged. Paths for which skip
+// returns true are ignored. The refreshed manifest is written back so the
+// next check only hashes what changed since this one.
+func (u *Updater) loadTreeManifest(root, cacheName string, skip func(relPath string) bool) (*treeManifest, error) {
+	cachePath := filepath.Join(u.directory, "data", "update-status", cacheName)
+	previous := readManifestFile(cachePath)
+
+	manifest := &treeManifest{Entries: make(map[string]manifestEntry)}
+	if !dirExists(root) {
+		return manifest, nil
+	}
+
+	rehashed := false
+	err := filepath.Walk(root, func(path string, info os.FileInfo, err error) error {
+		if err != nil {
+			return err
+		}
+		if info.IsDir() || !info.Mode().IsRegular() {
+			return nil
+		}
+		relPath, err := filepath.Rel(root, path)
+		if err != nil {
+			return err
+		}
+		if skip != nil && skip(relPath) {
+			return nil
+		}
+
+		entry := manifestEntry{Size: info.Size(), MTime: info.ModTime().UnixNano()}
+		// Caches written before git hashes were tracked re-hash once
+		if prev, ok := previous.Entries[relPath]; ok && prev.Size == entry.Size && prev.MTime == entry.MTime && prev.GitHash != "" {
+			entry.Hash = prev.Hash
+			entry.GitHash = prev.GitHash
+		} else {
+			entry.Hash, entry.GitHash, err = hashFileContents(path)
+			if err != nil {
+				return err
+			}
+			rehashed = true
+		}
+		manifest.Entries[relPath] = entry
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	// Persist the refreshed manifest (best effort); deletions also count as
+	// a change worth writing back
+	if rehashed || len(manifest.Entries) != len(previous.Entries) {
+		writeManifestFile(cachePath, manifest)
+	}
+
+	return manifest, nil
+}
+
+// subtreeMatches reports whether the files under the given tree-relative
+// prefix are identical in both manifests
+func subtreeMatches(local, update *treeManifest, prefix string) bool {
+	if !strings.HasSuffix(prefix, "/") {
+		prefix += "/"
+	}
+
+	localCount := 0
+	for path, localEntry := range local.Entries {
+		if !strings.HasPrefix(path, prefix) {
+			continue
+		}
+		localCount++
+		if updateEntry, ok := update.Entries[path]; !ok || updateEntry.Hash != localEntry.Hash {
+			return false
+		}
+	}
+
+	updateCount := 0
+	for path := range update.Entries {
+		if strings.HasPrefix(path, prefix) {
+			updateCount++
+		}
+	}
+	return localCount == updateCount
+}
+
+// hashFileContents returns the hex sha256 of a file's contents along with
+// its git blob ID (sha1 over "blob <size>\0" plus the contents), computed in
+// the same read pass
+func hashFileContents(path string) (contentHash, gitHash string, err error) {
+	file, err := os.Open(path)
+	if err != nil {
+		return "", "", err
+	}
+	defer file.Close()
+
+	info, err := file.Stat()
+	if err != nil {
+		return "", "", err
+	}
+
+	contentHasher := sha256.New()
+	blobHasher := sha1.New()
+	fmt.Fprintf(blobHasher, "blob %d\x00", info.Size())
+	if _, err := io.Copy(io.MultiWriter(contentHasher, blobHasher), file); err != nil {
+		return "", "", err
+	}
+	return hex.EncodeToString(contentHasher.Sum(nil)), hex.EncodeToString(blobHasher.Sum(nil)), nil
+}
+
+// readManifestFile loads a cached manifest; a missing or unreadable cache
+// just means every file gets hashed this time
+func readManifestFile(path string) *treeManifest {
+	manifest := &treeManifest{Entries: make(map[string]manifestEntry)}
+
+	file, err := os.Open(path)
+	if err != nil {
+		return manifest
+	}
+	defer file.Close()
+
+	if err := gob.NewDecoder(file).Decode(manifest); err != nil || manifest.Entries == nil {
+		return &treeManifest{Entries: make(map[string]manifestEntry)}
+	}
+	return manifest
+}
+
+// writeManifestFile atomically persists a manifest next to the other
+// update-status files
+func writeManifestFile(path string, manifest *treeManifest) {
+	tmpPath := path + ".tmp"
+	file, err := os.Create(tmpPath)
+	if err != nil {
+		return
+	}
+
+	if err := gob.NewEncoder(file).Encode(manifest); err != nil {
+		file.Close()
+		os.Remove(tmpPath)
+		return
+	}
+	if err := file.Close(); err != nil {
+		os.Remove(tmpPath)
+		return
+	}
+	os.Rename(tmpPath, path)
+}
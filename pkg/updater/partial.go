@@ -0,0 +1,357 @@
+// Copyright (C) 2026 pi-apps-go contributors
+// This file is part of Pi-Apps Go - a modern, cross-architecture/cross-platform, and modular Pi-Apps implementation in Go.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Module: partial.go
+// Description: Partial-clone update checking. The update repository is
+// cloned blob-less (--filter=blob:none), so checking for changes only
+// transfers commit and tree metadata; the update check diffs the remote
+// tree's blob IDs against git hashes kept in the local manifest, and a
+// sparse checkout then downloads just the blobs that actually changed,
+// running in the background while the results are already being shown.
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+package updater
+
+import (
+	"bytes"
+	"context"
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"sort"
+	"strings"
+)
+
+// remoteTree maps repository-relative paths to git blob IDs, as reported by
+// ls-tree on the fetched HEAD. It is available before any blob has been
+// downloaded.
+type remoteTree struct {
+	Entries map[string]string
+}
+
+// partialCheckRepo fetches the latest commit and tree metadata into the
+// update repository without downloading any file contents, decides which
+// paths differ from the local install, and starts a background sparse
+// checkout of exactly those paths. Returns an error if the partial pipeline
+// cannot be used, in which case the caller falls back to a full clone.
+func (u *Updater) partialCheckRepo(ctx context.Context) error {
+	updateDir := filepath.Join(u.directory, "update")
+	repoDir := filepath.Join(updateDir, "pi-apps")
+
+	if isPartialCloneRepo(repoDir) {
+		// Metadata-only fetch of the latest commit
+		if err := runGit(ctx, repoDir, "fetch", "-q", "--depth=1", "origin", "HEAD"); err != nil {
+			return fmt.Errorf("partial fetch failed: %w", err)
+		}
+		if err := runGit(ctx, repoDir, "reset", "-q", "--soft", "FETCH_HEAD"); err != nil {
+			return fmt.Errorf("failed to advance to fetched commit: %w", err)
+		}
+	} else {
+		// Fresh blob-less clone: only commits and trees are transferred now
+		os.RemoveAll(updateDir)
+		if err := os.MkdirAll(updateDir, 0755); err != nil {
+			return fmt.Errorf("failed to create update directory: %w", err)
+		}
+		if err := runGit(ctx, updateDir, "clone", "-q", "--depth=1", "--filter=blob:none", "--no-checkout", u.gitURL, "pi-apps"); err != nil {
+			os.RemoveAll(repoDir)
+			return fmt.Errorf("partial clone failed: %w", err)
+		}
+	}
+
+	remote, err := loadRemoteTree(ctx, repoDir)
+	if err != nil {
+		return err
+	}
+
+	// Create the online app directories right away so listings of the
+	// online repository are complete before any blob arrives, and prune
+	// directories of apps that no longer exist upstream so removed apps
+	// are still detected
+	remoteApps := remote.apps()
+	for app := range remoteApps {
+		os.MkdirAll(filepath.Join(repoDir, "apps", app), 0755)
+	}
+	if entries, err := os.ReadDir(filepath.Join(repoDir, "apps")); err == nil {
+		for _, entry := range entries {
+			if entry.IsDir() && !remoteApps[entry.Name()] {
+				os.RemoveAll(filepath.Join(repoDir, "apps", entry.Name()))
+			}
+		}
+	}
+
+	// Work out which paths need their contents, then fetch those blobs in
+	// the background; callers that copy from the update tree wait on this
+	// via waitForRepoCheckout, while the diffing itself needs no blobs
+	paths, err := u.changedRemotePaths(remote)
+	if err != nil {
+		return err
+	}
+	u.remote = remote
+
+	u.checkoutWG.Add(1)
+	go func() {
+		defer u.checkoutWG.Done()
+		u.checkoutErr = sparseCheckout(context.Background(), repoDir, paths)
+	}()
+
+	return nil
+}
+
+// waitForRepoCheckout blocks until the background sparse checkout started by
+// partialCheckRepo has materialized the changed files (no-op otherwise)
+func (u *Updater) waitForRepoCheckout() error {
+	u.checkoutWG.Wait()
+	return u.checkoutErr
+}
+
+// changedRemotePaths lists the sparse-checkout paths whose contents are
+// needed, using only tree metadata and the local manifest's git hashes.
+// Changed files outside apps/ are listed individually; for apps the whole
+// app directory is listed as soon as any file in it differs, because
+// refreshApp replaces the local app directory wholesale.
+func (u *Updater) changedRemotePaths(remote *remoteTree) ([]string, error) {
+	local, err := u.localFullManifest()
+	if err != nil {
+		return nil, err
+	}
+
+	// Local files under each app, for detecting locally-deleted files
+	localAppFiles := make(map[string]int)
+	for path := range local.Entries {
+		if app := appOfPath(path); app != "" {
+			localAppFiles[app]++
+		}
+	}
+	remoteAppFiles := make(map[string]int)
+
+	var changed []string
+	changedApps := make(map[string]bool)
+	for path, blobID := range remote.Entries {
+		app := appOfPath(path)
+		if app != "" {
+			remoteAppFiles[app]++
+		}
+		if entry, ok := local.Entries[path]; ok && entry.GitHash == blobID {
+			continue
+		}
+		if app != "" {
+			changedApps[app] = true
+			continue
+		}
+		changed = append(changed, path)
+	}
+
+	// An app whose file count shrank upstream also needs re-materializing
+	for app, count := range remoteAppFiles {
+		if localAppFiles[app] != count {
+			changedApps[app] = true
+		}
+	}
+
+	for app := range changedApps {
+		changed = append(changed, "apps/"+app+"/")
+	}
+	return changed, nil
+}
+
+// localFullManifest returns (building if necessary) the manifest of the
+// whole local install used by the partial-clone diff
+func (u *Updater) localFullManifest() (*treeManifest, error) {
+	if u.localFull != nil {
+		return u.localFull, nil
+	}
+	local, err := u.loadTreeManifest(u.directory, "manifest-local-full", func(relPath string) bool {
+		return strings.HasPrefix(relPath, ".git/") ||
+			strings.HasPrefix(relPath, "update/") ||
+			strings.HasPrefix(relPath, "data/") ||
+			strings.HasPrefix(relPath, "logs/")
+	})
+	if err != nil {
+		return nil, err
+	}
+	u.localFull = local
+	return local, nil
+}
+
+// appOfPath returns the app name when path is inside an app directory
+func appOfPath(path string) string {
+	if rest, ok := strings.CutPrefix(path, "apps/"); ok {
+		if app, _, ok := strings.Cut(rest, "/"); ok {
+			return app
+		}
+	}
+	return ""
+}
+
+// updatableFilesFromRemote diffs the remote tree's blob IDs against the
+// local manifest; it needs no update-tree files on disk, so it can run
+// while the sparse checkout is still downloading
+func (u *Updater) updatableFilesFromRemote() ([]FileChange, error) {
+	local, err := u.localFullManifest()
+	if err != nil {
+		return nil, err
+	}
+
+	paths := make([]string, 0, len(u.remote.Entries))
+	for path := range u.remote.Entries {
+		paths = append(paths, path)
+	}
+	sort.Strings(paths)
+
+	var updatable []FileChange
+	for _, path := range paths {
+		// Apps and runtime data are handled separately, as in fileManifests
+		if strings.HasPrefix(path, "apps/") || strings.HasPrefix(path, "data/") {
+			continue
+		}
+		if entry, ok := local.Entries[path]; ok && entry.GitHash == u.remote.Entries[path] {
+			continue
+		}
+		updatable = append(updatable, FileChange{
+			Path:              path,
+			Type:              u.getFileType(path),
+			RequiresRecompile: u.requiresRecompile(path),
+			IsModuleFile:      u.IsModuleFile(path),
+		})
+	}
+
+	return u.filterExcludedFiles(updatable), nil
+}
+
+// updatableAppsFromRemote reports the apps whose remote tree differs from
+// the local apps directory, again using only blob IDs
+func (u *Updater) updatableAppsFromRemote() ([]string, error) {
+	local, err := u.localFullManifest()
+	if err != nil {
+		return nil, err
+	}
+
+	localAppFiles := make(map[string]int)
+	for path := range local.Entries {
+		if app := appOfPath(path); app != "" {
+			localAppFiles[app]++
+		}
+	}
+
+	remoteAppFiles := make(map[string]int)
+	mismatched := make(map[string]bool)
+	for path, blobID := range u.remote.Entries {
+		app := appOfPath(path)
+		if app == "" {
+			continue
+		}
+		remoteAppFiles[app]++
+		if entry, ok := local.Entries[path]; !ok || entry.GitHash != blobID {
+			mismatched[app] = true
+		}
+	}
+
+	var updatable []string
+	for app, count := range remoteAppFiles {
+		if mismatched[app] || localAppFiles[app] != count {
+			updatable = append(updatable, app)
+		}
+	}
+	sort.Strings(updatable)
+	return updatable, nil
+}
+
+// apps returns the set of app names present in the remote tree
+func (t *remoteTree) apps() map[string]bool {
+	apps := make(map[string]bool)
+	for path := range t.Entries {
+		if rest, ok := strings.CutPrefix(path, "apps/"); ok {
+			if app, _, ok := strings.Cut(rest, "/"); ok {
+				apps[app] = true
+			}
+		}
+	}
+	return apps
+}
+
+// isPartialCloneRepo reports whether repoDir is a blob-less clone created by
+// partialCheckRepo
+func isPartialCloneRepo(repoDir string) bool {
+	if !dirExists(filepath.Join(repoDir, ".git")) {
+		return false
+	}
+	output, err := exec.Command("git", "-C", repoDir, "config", "remote.origin.partialclonefilter").Output()
+	return err == nil && strings.TrimSpace(string(output)) != ""
+}
+
+// loadRemoteTree reads every (path, blob ID) pair of the fetched HEAD
+func loadRemoteTree(ctx context.Context, repoDir string) (*remoteTree, error) {
+	cmd := exec.CommandContext(ctx, "git", "-C", repoDir, "ls-tree", "-r", "-z", "HEAD")
+	output, err := cmd.Output()
+	if err != nil {
+		return nil, fmt.Errorf("failed to list remote tree: %w", err)
+	}
+
+	tree := &remoteTree{Entries: make(map[string]string)}
+	for _, record := range bytes.Split(output, []byte{0}) {
+		// Each record is "<mode> <type> <oid>\t<path>"
+		meta, path, ok := bytes.Cut(record, []byte{'\t'})
+		if !ok {
+			continue
+		}
+		fields := bytes.Fields(meta)
+		if len(fields) != 3 || string(fields[1]) != "blob" {
+			continue
+		}
+		tree.Entries[string(path)] = string(fields[2])
+	}
+	return tree, nil
+}
+
+// sparseCheckout materializes only the given paths, which is what limits the
+// blob download to the files that actually changed
+func sparseCheckout(ctx context.Context, repoDir string, paths []string) error {
+	if len(paths) == 0 {
+		return nil
+	}
+
+	// Feed the literal paths as sparse patterns
+	cmd := exec.CommandContext(ctx, "git", "-C", repoDir, "sparse-checkout", "set", "--no-cone", "--stdin")
+	var patterns strings.Builder
+	for _, path := range paths {
+		patterns.WriteString("/" + path + "\n")
+	}
+	cmd.Stdin = strings.NewReader(patterns.String())
+	if err := cmd.Run(); err != nil {
+		return fmt.Errorf("failed to set sparse paths: %w", err)
+	}
+
+	if err := runGit(ctx, repoDir, "checkout", "-q", "-f", "HEAD"); err != nil {
+		return fmt.Errorf("sparse checkout failed: %w", err)
+	}
+	return nil
+}
+
+// runGit runs one git command in dir, surfacing stderr in the error
+func runGit(ctx context.Context, dir string, args ...string) error {
+	cmd := exec.CommandContext(ctx, "git", args...)
+	cmd.Dir = dir
+	var stderr bytes.Buffer
+	cmd.Stderr = &stderr
+	if err := cmd.Run(); err != nil {
+		if msg := strings.TrimSpace(stderr.String()); msg != "" {
+			return fmt.Errorf("git %s: %s", args[0], msg)
+		}
+		return fmt.Errorf("git %s: %w", args[0], err)
+	}
+	return nil
+}
@@ -29,8 +29,10 @@ import (
 	"os"
 	"os/exec"
 	"path/filepath"
+	"runtime"
 	"sort"
 	"strings"
+	"sync"
 	"time"
 
 	"github.com/gen2brain/beeep"
@@ -67,6 +69,14 @@ type Updater struct {
 	noStatus    bool
 	noUpdate    bool
 	useTerminal bool
+
+	// Partial-clone pipeline state (see partial.go): the remote tree from
+	// the metadata fetch, the cached local manifest it is diffed against,
+	// and the background sparse checkout that downloads changed blobs
+	remote      *remoteTree
+	localFull   *treeManifest
+	checkoutWG  sync.WaitGroup
+	checkoutErr error
 }
 
 // FileChange represents a file that needs updating
@@ -194,12 +204,28 @@ func (u *Updater) CheckRepo(ctx context.Context) error {
 		return nil
 	}
 
+	defer api.TraceSpan("updater.check-repo")()
+
 	fmt.Fprint(os.Stderr, "Checking for online changes... ")
 
 	updateDir := filepath.Join(u.directory, "update")
 	repoDir := filepath.Join(updateDir, "pi-apps")
 	updaterScript := filepath.Join(repoDir, "updater")
 
+	// Prefer the partial-clone pipeline: it transfers only commit and tree
+	// metadata up front and downloads just the changed blobs afterwards.
+	// Existing full clones keep using the pull path below; any partial
+	// failure (old git, odd server) falls through to the full clone.
+	if isPartialCloneRepo(repoDir) || !fileExists(updaterScript) {
+		if err := u.partialCheckRepo(ctx); err == nil {
+			fmt.Fprintln(os.Stderr, "Done")
+			return nil
+		} else {
+			fmt.Fprintf(os.Stderr, "partial clone unavailable (%v), using full clone... ", err)
+			u.remote = nil
+		}
+	}
+
 	// If updater exists in update folder, try git pull first
 	if fileExists(updaterScript) {
 		cmd := exec.CommandContext(ctx, "git", "pull", "-q")
@@ -252,48 +278,41 @@ func (u *Updater) GetUpdatableFiles() ([]FileChange, error) {
 		return u.loadCachedFiles(statusFile)
 	}
 
-	// Compare files between update and main directory
-	files, err := u.listAllFiles()
+	// With a partial clone the remote tree metadata already tells us what
+	// changed, before any file contents have been downloaded
+	if u.remote != nil {
+		return u.updatableFilesFromRemote()
+	}
+
+	// Compare the content-hash manifests of the update and main directory;
+	// only files whose size or mtime changed since the last check get
+	// re-hashed, and the comparison itself is an in-memory diff
+	localManifest, updateManifest, err := u.fileManifests()
 	if err != nil {
 		return nil, err
 	}
 
-	var updatable []FileChange
-	for _, file := range files {
-		localPath := filepath.Join(u.directory, file)
-		updatePath := filepath.Join(u.directory, "update", "pi-apps", file)
-
-		// Skip if file doesn't exist locally (new file)
-		if !fileExists(localPath) {
-			if fileExists(updatePath) {
-				fc := FileChange{
-					Path:              file,
-					Type:              u.getFileType(file),
-					RequiresRecompile: u.requiresRecompile(file),
-					IsModuleFile:      u.IsModuleFile(file),
-				}
-				updatable = append(updatable, fc)
-			}
-			continue
-		}
+	// Files only present locally are left alone, so the update manifest
+	// drives the diff (sorted for a stable result order)
+	updateFiles := make([]string, 0, len(updateManifest.Entries))
+	for file := range updateManifest.Entries {
+		updateFiles = append(updateFiles, file)
+	}
+	sort.Strings(updateFiles)
 
-		// Skip if file doesn't exist in update
-		if !fileExists(updatePath) {
+	var updatable []FileChange
+	for _, file := range updateFiles {
+		if local, ok := localManifest.Entries[file]; ok && local.Hash == updateManifest.Entries[file].Hash {
 			continue
 		}
-
-		// Compare file contents
-		if match, err := u.filesMatch(localPath, updatePath); err != nil {
-			return nil, err
-		} else if !match {
-			fc := FileChange{
-				Path:              file,
-				Type:              u.getFileType(file),
-				RequiresRecompile: u.requiresRecompile(file),
-				IsModuleFile:      u.IsModuleFile(file),
-			}
-			updatable = append(updatable, fc)
+		// File is new or its contents differ
+		fc := FileChange{
+			Path:              file,
+			Type:              u.getFileType(file),
+			RequiresRecompile: u.requiresRecompile(file),
+			IsModuleFile:      u.IsModuleFile(file),
 		}
+		updatable = append(updatable, fc)
 	}
 
 	// Filter out excluded files
@@ -310,16 +329,28 @@ func (u *Updater) GetUpdatableApps() ([]string, error) {
 		return u.loadCachedApps(statusFile)
 	}
 
+	// With a partial clone the per-app diff comes straight from the
+	// remote tree's blob IDs
+	if u.remote != nil {
+		return u.updatableAppsFromRemote()
+	}
+
 	// Get list of all apps from online repository
 	onlineApps, err := api.ListApps("online")
 	if err != nil {
 		return nil, err
 	}
 
+	// Diff the app trees via their content-hash manifests instead of
+	// walking every app directory
+	localApps, updateApps, err := u.appManifests()
+	if err != nil {
+		return nil, err
+	}
+
 	var updatable []string
 	for _, app := range onlineApps {
 		localPath := filepath.Join(u.directory, "apps", app)
-		updatePath := filepath.Join(u.directory, "update", "pi-apps", "apps", app)
 
 		// If app doesn't exist locally, it's new
 		if !dirExists(localPath) {
@@ -328,9 +359,7 @@ func (u *Updater) GetUpdatableApps() ([]string, error) {
 		}
 
 		// Compare app directories
-		if match, err := u.directoriesMatch(localPath, updatePath); err != nil {
-			return nil, err
-		} else if !match {
+		if !subtreeMatches(localApps, updateApps, app) {
 			updatable = append(updatable, app)
 		}
 	}
@@ -410,6 +439,10 @@ func (u *Updater) CheckRemovedDeprecatedApps() error {
 
 // UpdateFiles updates the specified files
 func (u *Updater) UpdateFiles(files []FileChange) error {
+	// Copying from the update tree needs the sparse checkout finished
+	if err := u.waitForRepoCheckout(); err != nil {
+		return fmt.Errorf("failed to download changed files: %w", err)
+	}
 	for _, file := range files {
 		if err := u.updateFile(file.Path); err != nil {
 			return fmt.Errorf("failed to update file %s: %w", file.Path, err)
@@ -418,29 +451,110 @@ func (u *Updater) UpdateFiles(files []FileChange) error {
 	return nil
 }
 
-// UpdateApps updates the specified apps
+// UpdateApps updates the specified apps. Apps that only need their folder
+// refreshed are independent directory copies and run on a worker pool;
+// reinstalls stay sequential because they drive the package manager. The
+// per-app status recomputation and app-list preload invalidation happen once
+// at the end rather than per app.
 func (u *Updater) UpdateApps(apps []string) error {
+	// Copying from the update tree needs the sparse checkout finished
+	if err := u.waitForRepoCheckout(); err != nil {
+		return fmt.Errorf("failed to download changed apps: %w", err)
+	}
+
+	var reinstalls, refreshes []string
 	for _, app := range apps {
 		willReinstall, err := api.WillReinstall(app)
 		if err != nil {
 			return fmt.Errorf("failed to check if app %s will be reinstalled: %w", app, err)
 		}
-
 		if willReinstall {
-			if err := u.updateApp(app); err != nil {
-				return fmt.Errorf("failed to update app %s: %w", app, err)
-			}
+			reinstalls = append(reinstalls, app)
 		} else {
-			if err := u.refreshApp(app); err != nil {
-				return fmt.Errorf("failed to refresh app %s: %w", app, err)
+			refreshes = append(refreshes, app)
+		}
+	}
+
+	if err := u.refreshApps(refreshes); err != nil {
+		return err
+	}
+
+	for _, app := range reinstalls {
+		if err := u.updateApp(app); err != nil {
+			return fmt.Errorf("failed to update app %s: %w", app, err)
+		}
+	}
+
+	if len(apps) > 0 {
+		u.finishAppUpdates()
+	}
+	return nil
+}
+
+// refreshApps copies the updated app folders concurrently; each copy only
+// touches its own app directory, so they are independent of each other
+func (u *Updater) refreshApps(apps []string) error {
+	if len(apps) == 0 {
+		return nil
+	}
+
+	workers := runtime.GOMAXPROCS(0)
+	if workers > len(apps) {
+		workers = len(apps)
+	}
+
+	jobs := make(chan string)
+	errs := make([]error, len(apps))
+	indexOf := make(map[string]int, len(apps))
+	for i, app := range apps {
+		indexOf[app] = i
+	}
+
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for app := range jobs {
+				if err := u.refreshApp(app); err != nil {
+					errs[indexOf[app]] = fmt.Errorf("failed to refresh app %s: %w", app, err)
+				}
 			}
+		}()
+	}
+	for _, app := range apps {
+		jobs <- app
+	}
+	close(jobs)
+	wg.Wait()
+
+	for _, err := range errs {
+		if err != nil {
+			return err
 		}
 	}
 	return nil
 }
 
+// finishAppUpdates performs the batched post-update work: one pass over all
+// package-app statuses (refreshed packages files can change them) and one
+// invalidation of the preloaded app lists
+func (u *Updater) finishAppUpdates() {
+	if err := api.RefreshAllPkgAppStatus(); err != nil {
+		fmt.Fprintf(os.Stderr, "Warning: Failed to refresh package-app statuses: %v\n", err)
+	}
+
+	// Dropping the preload directory makes the GUI rebuild its cached app
+	// lists on next use; doing it once here covers every updated app
+	if err := os.RemoveAll(filepath.Join(u.directory, "data", "preload")); err != nil {
+		fmt.Fprintf(os.Stderr, "Warning: Failed to invalidate preloaded app lists: %v\n", err)
+	}
+}
+
 // PerformUpdate handles the complete update process with compilation
 func (u *Updater) PerformUpdate(files []FileChange, apps []string) *UpdateResult {
+	defer api.TraceSpan("updater.perform-update")()
+
 	result := &UpdateResult{
 		Success: true,
 		RollbackData: &RollbackData{
@@ -753,6 +867,13 @@ func (u *Updater) refreshApp(app string) error {
 }
 
 func (u *Updater) updateGit() error {
+	// A partial clone's .git is blob-less and sparse; copying it over the
+	// main checkout would leave a repository that needs the network for
+	// ordinary operations, so keep the existing .git in that case
+	if isPartialCloneRepo(filepath.Join(u.directory, "update", "pi-apps")) {
+		return nil
+	}
+
 	// Remove old .git folder
 	gitDir := filepath.Join(u.directory, ".git")
 	if err := os.RemoveAll(gitDir); err != nil {
@@ -872,7 +993,20 @@ func (u *Updater) filesMatch(file1, file2 string) (bool, error) {
 }
 
 func (u *Updater) directoriesMatch(dir1, dir2 string) (bool, error) {
-	// Use diff command for directory comparison
+	// App directories are compared through the content-hash manifests
+	localAppsDir := filepath.Join(u.directory, "apps") + string(filepath.Separator)
+	updateAppsDir := filepath.Join(u.directory, "update", "pi-apps", "apps") + string(filepath.Separator)
+	if strings.HasPrefix(dir1, localAppsDir) && strings.HasPrefix(dir2, updateAppsDir) {
+		if app := strings.TrimPrefix(dir1, localAppsDir); app == strings.TrimPrefix(dir2, updateAppsDir) {
+			localApps, updateApps, err := u.appManifests()
+			if err != nil {
+				return false, err
+			}
+			return subtreeMatches(localApps, updateApps, app), nil
+		}
+	}
+
+	// Fall back to the diff command for arbitrary directory pairs
 	cmd := exec.Command("diff", "-rq", dir1, dir2)
 	err := cmd.Run()
 	return err == nil, nil
@@ -1123,6 +1257,12 @@ func (u *Updater) SetStatus(ctx context.Context) error {
 		return fmt.Errorf("failed to write status files: %w", err)
 	}
 
+	// Let the background blob download finish so the process does not exit
+	// mid-checkout and leave the update repository locked
+	if err := u.waitForRepoCheckout(); err != nil {
+		api.WarningT("Failed to download changed files: %v", err)
+	}
+
 	// Check status and return appropriate exit code
 	return u.GetStatus()
 }